@@ -0,0 +1,132 @@
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#	include <malloc.h>
+#endif
+
+// every allocation of the process goes through here, so the benchmarks can tell how many they caused
+namespace
+{
+	std::atomic<size_t> allocation_count { 0 };
+	std::atomic<size_t> allocated_bytes { 0 };
+
+	void* Allocate(size_t size)
+	{
+		allocation_count.fetch_add(1, std::memory_order_relaxed);
+		allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+		void* memory = std::malloc(size > 0 ? size : 1);
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		return memory;
+	}
+
+	void* AllocateAligned(size_t size, std::align_val_t alignment)
+	{
+		allocation_count.fetch_add(1, std::memory_order_relaxed);
+		allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+		const size_t alignment_bytes = static_cast<size_t>(alignment);
+
+#ifdef _WIN32
+		void* memory = _aligned_malloc(size > 0 ? size : 1, alignment_bytes);
+#else
+		// the size has to be a non zero multiple of the alignment
+		size_t aligned_size = std::max<size_t>((size + alignment_bytes - 1) / alignment_bytes, 1) * alignment_bytes;
+		void*  memory		= std::aligned_alloc(alignment_bytes, aligned_size);
+#endif
+
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		return memory;
+	}
+
+	void FreeAligned(void* memory)
+	{
+#ifdef _WIN32
+		_aligned_free(memory);
+#else
+		std::free(memory);
+#endif
+	}
+} // namespace
+
+size_t GetAllocationCount()
+{
+	return allocation_count.load(std::memory_order_relaxed);
+}
+
+size_t GetAllocatedBytes()
+{
+	return allocated_bytes.load(std::memory_order_relaxed);
+}
+
+void* operator new(size_t size)
+{
+	return Allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+	return Allocate(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+	return AllocateAligned(size, alignment);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+	return AllocateAligned(size, alignment);
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+	FreeAligned(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+	FreeAligned(memory);
+}
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept
+{
+	FreeAligned(memory);
+}
+
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept
+{
+	FreeAligned(memory);
+}
\ No newline at end of file
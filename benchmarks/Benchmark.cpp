@@ -0,0 +1,143 @@
+#include "Benchmark.hpp"
+#include <Utils/JSONUtils.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+
+BenchmarkRunner::BenchmarkRunner(const std::string& filter, size_t repetitions)
+	: mFilter { filter }, mRepetitions { std::max<size_t>(repetitions, 1) }
+{
+}
+
+bool BenchmarkRunner::IsSelected(const std::string& name) const
+{
+	return mFilter.empty() || name.find(mFilter) != std::string::npos;
+}
+
+void BenchmarkRunner::Run(
+	const std::string&			 name,
+	size_t						 operations,
+	const std::function<void()>& run,
+	const std::function<void()>& setup)
+{
+	if (IsSelected(name) == false)
+	{
+		return;
+	}
+
+	operations = std::max<size_t>(operations, 1);
+
+	double fastest_run	   = std::numeric_limits<double>::max();
+	size_t run_allocations = 0;
+	size_t run_bytes	   = 0;
+
+	// the first run only warms the caches and the pools up
+	for (size_t repetition = 0; repetition <= mRepetitions; repetition++)
+	{
+		if (setup)
+		{
+			setup();
+		}
+
+		size_t allocations_before = GetAllocationCount();
+		size_t bytes_before		  = GetAllocatedBytes();
+
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		run();
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+		if (repetition == 0)
+		{
+			continue;
+		}
+
+		fastest_run		= std::min(fastest_run, std::chrono::duration<double, std::nano>(end - begin).count());
+		run_allocations = GetAllocationCount() - allocations_before;
+		run_bytes		= GetAllocatedBytes() - bytes_before;
+	}
+
+	BenchmarkResult result;
+	result.name						 = name;
+	result.operations				 = operations;
+	result.nanoseconds_per_operation = fastest_run / operations;
+	result.allocations_per_operation = static_cast<double>(run_allocations) / operations;
+	result.bytes_per_operation		 = static_cast<double>(run_bytes) / operations;
+
+	std::printf(
+		"%-48s %14.1f ns/op %10.2f allocs/op %12.1f B/op\n",
+		result.name.c_str(),
+		result.nanoseconds_per_operation,
+		result.allocations_per_operation,
+		result.bytes_per_operation);
+
+	mResults.push_back(result);
+}
+
+const std::vector<BenchmarkResult>& BenchmarkRunner::GetResults() const
+{
+	return mResults;
+}
+
+void BenchmarkRunner::Print() const
+{
+	std::printf("\n%zu benchmarks, best of %zu runs each\n", mResults.size(), mRepetitions);
+}
+
+void BenchmarkRunner::Save(const std::string& filepath) const
+{
+	nlohmann::json results = nlohmann::json::array();
+	for (const BenchmarkResult& result : mResults)
+	{
+		results.push_back({
+			{ "name", result.name },
+			{ "operations", result.operations },
+			{ "ns_per_op", result.nanoseconds_per_operation },
+			{ "allocs_per_op", result.allocations_per_operation },
+			{ "bytes_per_op", result.bytes_per_operation },
+		});
+	}
+
+	SaveJSONToFile(filepath, { { "benchmarks", results } });
+}
+
+bool BenchmarkRunner::CompareWithBaseline(const std::string& filepath, double tolerance) const
+{
+	nlohmann::json baseline = LoadJSONFromFile(filepath);
+	if (baseline.contains("benchmarks") == false)
+	{
+		std::printf("No baseline found in \"%s\"\n", filepath.c_str());
+		return false;
+	}
+
+	bool passed = true;
+
+	std::printf("\nComparing against \"%s\" (tolerance %.0f%%)\n", filepath.c_str(), tolerance * 100.0);
+	for (const BenchmarkResult& result : mResults)
+	{
+		for (const nlohmann::json& entry : baseline["benchmarks"])
+		{
+			if (entry.value("name", "") != result.name)
+			{
+				continue;
+			}
+
+			double baseline_time		= entry.value("ns_per_op", 0.0);
+			double baseline_allocations = entry.value("allocs_per_op", 0.0);
+
+			// allocations are deterministic, any increase is a regression
+			bool slower		 = result.nanoseconds_per_operation > baseline_time * (1.0 + tolerance);
+			bool more_allocs = result.allocations_per_operation > baseline_allocations + 1e-9;
+			passed			 = passed && !slower && !more_allocs;
+
+			std::printf(
+				"%-48s %+7.1f%% time %+9.2f allocs/op %s\n",
+				result.name.c_str(),
+				baseline_time > 0.0 ? (result.nanoseconds_per_operation / baseline_time - 1.0) * 100.0 : 0.0,
+				result.allocations_per_operation - baseline_allocations,
+				slower || more_allocs ? "REGRESSION" : "ok");
+		}
+	}
+
+	return passed;
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+struct BenchmarkResult
+{
+		std::string name;
+
+		// operations performed by a single run
+		size_t operations;
+
+		double nanoseconds_per_operation;
+		double allocations_per_operation;
+		double bytes_per_operation;
+};
+
+// calls to the global operator new since the program started, see AllocationCounter.cpp
+size_t GetAllocationCount();
+size_t GetAllocatedBytes();
+
+class BenchmarkRunner
+{
+		std::vector<BenchmarkResult> mResults;
+
+		// only benchmarks whose name contains it are run
+		std::string mFilter;
+		size_t		mRepetitions;
+
+	public:
+		BenchmarkRunner(const std::string& filter, size_t repetitions);
+
+		// run() performs the given amount of operations, it is called once to warm up and then once per
+		// repetition, keeping the fastest; setup() is called before each of them and is not measured
+		void Run(
+			const std::string&			 name,
+			size_t						 operations,
+			const std::function<void()>& run,
+			const std::function<void()>& setup = {});
+
+		bool IsSelected(const std::string& name) const;
+
+		const std::vector<BenchmarkResult>& GetResults() const;
+
+		void Print() const;
+		void Save(const std::string& filepath) const;
+
+		// false if any benchmark also present in the baseline is slower by more than the tolerance (0.1 = 10%)
+		bool CompareWithBaseline(const std::string& filepath, double tolerance) const;
+};
+
+// the scenarios, grouped by subsystem
+void RunSceneBenchmarks(BenchmarkRunner& runner);
+void RunResourceBenchmarks(BenchmarkRunner& runner, const std::string& data_directory);
+
+#endif
\ No newline at end of file
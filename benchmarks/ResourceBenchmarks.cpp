@@ -0,0 +1,271 @@
+#include "Benchmark.hpp"
+#include <Resources/CookedMesh.hpp>
+#include <Resources/ImageLoader.hpp>
+#include <Resources/MeshLoader.hpp>
+#include <Resources/MeshOptimizer.hpp>
+#include <Resources/ResourceManager.hpp>
+#include <Resources/VertexIndexMap.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <tuple>
+
+namespace
+{
+	// the mesh as the loader leaves it, without the upload, so the manager can be measured without a context
+	struct MeshResource
+	{
+			MeshData mesh;
+
+			MeshResource(const std::string&)
+			{
+				CreateCube(mesh.vertices, mesh.indices);
+			}
+	};
+
+	void MeshBenchmarks(BenchmarkRunner& runner, const std::string& data_directory)
+	{
+		std::vector<Vertex>		  vertices;
+		std::vector<unsigned int> indices;
+
+		auto clear = [&]() {
+			vertices.clear();
+			indices.clear();
+		};
+
+		runner.Run("Mesh CreateCube", 1, [&]() { CreateCube(vertices, indices); }, clear);
+
+		const std::string filepath = data_directory + "/meshes/pish.obj";
+		if (std::filesystem::exists(filepath) == false)
+		{
+			std::cout << "Skipping the OBJ benchmark, " << filepath << " is missing" << std::endl;
+			return;
+		}
+
+		runner.Run("Mesh LoadModel OBJ", 1, [&]() { LoadModel(filepath, vertices, indices); }, clear);
+
+		// the warm-up run cooks it if needed, the measured ones only map and validate it
+		// (the pages are read later, by the upload)
+		CookedMesh cooked;
+		MeshData   fallback;
+		runner.Run("Mesh LoadCookedMesh", 1, [&]() { LoadCookedMesh(filepath, cooked, fallback); });
+	}
+
+	// a grid of quads split in two triangles, about a million triangles in total
+	constexpr int GRID_QUADS_PER_SIDE = 708;
+
+	// the OBJ splits it in strips, like a level made of many objects
+	constexpr int GRID_ROWS_PER_SHAPE = 4;
+
+	// the corners as an OBJ exporter writes them: every inner vertex is shared by six of them
+	std::vector<VertexIndexMap::Key> GenerateGridCorners()
+	{
+		constexpr int SIDE = GRID_QUADS_PER_SIDE + 1;
+
+		std::vector<VertexIndexMap::Key> corners;
+		corners.reserve(GRID_QUADS_PER_SIDE * GRID_QUADS_PER_SIDE * 6);
+
+		for (int y = 0; y < GRID_QUADS_PER_SIDE; y++)
+		{
+			for (int x = 0; x < GRID_QUADS_PER_SIDE; x++)
+			{
+				int quad[] = { y * SIDE + x, y * SIDE + x + 1, (y + 1) * SIDE + x + 1, (y + 1) * SIDE + x };
+
+				for (int corner : { 0, 1, 2, 0, 2, 3 })
+				{
+					corners.push_back(VertexIndexMap::Key { quad[corner], 0, quad[corner] });
+				}
+			}
+		}
+
+		return corners;
+	}
+
+	bool WriteGridOBJ(const std::string& filepath)
+	{
+		std::ofstream file { filepath };
+		if (file.is_open() == false)
+		{
+			return false;
+		}
+
+		constexpr int SIDE = GRID_QUADS_PER_SIDE + 1;
+
+		for (int y = 0; y < SIDE; y++)
+		{
+			for (int x = 0; x < SIDE; x++)
+			{
+				file << "v " << x << " 0 " << y << "\n";
+				file << "vt " << static_cast<float>(x) / GRID_QUADS_PER_SIDE << " "
+					 << static_cast<float>(y) / GRID_QUADS_PER_SIDE << "\n";
+			}
+		}
+
+		file << "vn 0 1 0\n";
+
+		// obj indices start at 1
+		const std::vector<VertexIndexMap::Key> corners = GenerateGridCorners();
+		for (size_t i = 0; i < corners.size(); i += 3)
+		{
+			if (i % (GRID_ROWS_PER_SHAPE * GRID_QUADS_PER_SIDE * 6) == 0)
+			{
+				file << "o strip" << i / (GRID_ROWS_PER_SHAPE * GRID_QUADS_PER_SIDE * 6) << "\n";
+			}
+
+			file << "f";
+			for (size_t corner = i; corner < i + 3; corner++)
+			{
+				file << " " << corners[corner].position + 1 << "/" << corners[corner].texture_coordinates + 1 << "/1";
+			}
+			file << "\n";
+		}
+
+		return file.good();
+	}
+
+	void DeduplicationBenchmarks(BenchmarkRunner& runner)
+	{
+		const std::vector<VertexIndexMap::Key> corners = GenerateGridCorners();
+		std::vector<unsigned int>			   indices;
+		indices.reserve(corners.size());
+
+		// what LoadModel() did before: a lookup, and two more to insert
+		runner.Run("Vertex dedup std::map (1M triangles)", corners.size(), [&]() {
+			indices.clear();
+
+			std::map<std::tuple<int, int, int>, unsigned int> unique_vertices;
+			for (const VertexIndexMap::Key& corner : corners)
+			{
+				std::tuple<int, int, int> key
+					= std::make_tuple(corner.position, corner.normal, corner.texture_coordinates);
+
+				if (unique_vertices.find(key) != unique_vertices.end())
+				{
+					indices.push_back(unique_vertices[key]);
+					continue;
+				}
+
+				size_t current_index = unique_vertices.size();
+				unique_vertices[key] = static_cast<unsigned int>(current_index);
+				indices.push_back(unique_vertices[key]);
+			}
+		});
+
+		runner.Run("Vertex dedup VertexIndexMap (1M triangles)", corners.size(), [&]() {
+			indices.clear();
+
+			VertexIndexMap unique_vertices { corners.size() };
+			for (const VertexIndexMap::Key& corner : corners)
+			{
+				bool inserted = false;
+				indices.push_back(unique_vertices.FindOrInsert(corner, inserted));
+			}
+		});
+
+		if (runner.IsSelected("Mesh LoadModel OBJ (1M triangles)") == false
+			&& runner.IsSelected("Mesh PackVertices (1M triangles)") == false
+			&& runner.IsSelected("Mesh OptimizeMesh (1M triangles)") == false)
+		{
+			return;
+		}
+
+		const std::string filepath = (std::filesystem::temp_directory_path() / "psx_benchmark_grid.obj").string();
+		if (WriteGridOBJ(filepath) == false)
+		{
+			std::cout << "Skipping the large OBJ benchmark, " << filepath << " cannot be written" << std::endl;
+			return;
+		}
+
+		MeshData mesh;
+		runner.Run(
+			"Mesh LoadModel OBJ (1M triangles)",
+			corners.size() / 3,
+			[&]() { LoadModel(filepath, mesh.vertices, mesh.indices); },
+			[&]() { mesh = MeshData {}; });
+
+		// what a packed model adds to the loading
+		if (runner.IsSelected("Mesh PackVertices (1M triangles)"))
+		{
+			mesh = MeshData {};
+			LoadModel(filepath, mesh.vertices, mesh.indices);
+
+			std::vector<PackedVertex> packed_vertices;
+			runner.Run("Mesh PackVertices (1M triangles)", mesh.vertices.size(), [&]() {
+				PackVertices(GetMeshView(mesh), packed_vertices);
+			});
+		}
+
+		// what cooking an optimized mesh adds, the grid comes in rows like most exporters write it
+		if (runner.IsSelected("Mesh OptimizeMesh (1M triangles)"))
+		{
+			MeshData source;
+			LoadModel(filepath, source.vertices, source.indices);
+
+			MeshOptimizationStats stats {};
+			runner.Run(
+				"Mesh OptimizeMesh (1M triangles)",
+				source.indices.size() / 3,
+				[&]() { stats = OptimizeMesh(mesh, MeshOptimization::VERTEX_CACHE_AND_OVERDRAW); },
+				[&]() { mesh = source; });
+
+			std::cout << "Mesh OptimizeMesh ACMR: " << stats.acmr_before << " -> " << stats.acmr_after << std::endl;
+		}
+
+		std::filesystem::remove(filepath);
+	}
+
+	void ImageBenchmarks(BenchmarkRunner& runner, const std::string& data_directory)
+	{
+		ImageData image;
+
+		runner.Run("Image GenerateDummyImage", 1, [&]() { GenerateDummyImage(glm::ivec2 { 256, 256 }, image); });
+
+		const std::string filepath = data_directory + "/images/pish.png";
+		if (std::filesystem::exists(filepath) == false)
+		{
+			std::cout << "Skipping the PNG benchmark, " << filepath << " is missing" << std::endl;
+			return;
+		}
+
+		runner.Run("Image DecodeImage PNG", 1, [&]() { DecodeImage(filepath, image); });
+	}
+
+	void ResourceManagerBenchmarks(BenchmarkRunner& runner)
+	{
+		constexpr size_t RESOURCE_COUNT = 100;
+		constexpr size_t LOOKUP_COUNT	= 10000;
+
+		if (runner.IsSelected("ResourceManager lookup") == false)
+		{
+			return;
+		}
+
+		std::vector<std::string>			names;
+		std::vector<Resource<MeshResource>>	resources;
+		for (size_t i = 0; i < RESOURCE_COUNT; i++)
+		{
+			names.push_back("mesh " + std::to_string(i));
+			resources.emplace_back(names.back());
+		}
+
+		// every name is already loaded, this only measures finding it again
+		runner.Run("ResourceManager lookup", LOOKUP_COUNT, [&]() {
+			for (size_t i = 0; i < LOOKUP_COUNT; i++)
+			{
+				ResourceManager::GetInstance().GetResource<MeshResource>(names[i % RESOURCE_COUNT]);
+			}
+		});
+
+		resources.clear();
+		ResourceManager::GetInstance().DeleteResources<MeshResource>();
+	}
+} // namespace
+
+void RunResourceBenchmarks(BenchmarkRunner& runner, const std::string& data_directory)
+{
+	MeshBenchmarks(runner, data_directory);
+	DeduplicationBenchmarks(runner);
+	ImageBenchmarks(runner, data_directory);
+	ResourceManagerBenchmarks(runner);
+}
\ No newline at end of file
@@ -0,0 +1,391 @@
+#include "Benchmark.hpp"
+#include <Components/LogicComponent.hpp>
+#include <Components/LogicSystem.hpp>
+#include <ECS/World.hpp>
+#include <GameObject/GameObject.hpp>
+#include <GameObject/GameObjectManager.hpp>
+#include <Transformation/HierarchyManager.hpp>
+#include <Transformation/Transformation.hpp>
+#include <Transformation/TransformationComponent.hpp>
+#include <random>
+
+namespace
+{
+	constexpr float STEP = 1.0f / 60.0f;
+
+	// a cheap update, so that the cost measured is the one of reaching the component
+	template <int Kind>
+	class MixedLogic : public LogicComponent
+	{
+		public:
+			float value = 0.0f;
+
+			virtual void Update(float dt) override
+			{
+				value += dt * Kind;
+			}
+	};
+
+	class MoverLogic : public LogicComponent
+	{
+		public:
+			glm::vec3 position { 0.0f };
+			glm::vec3 velocity { 1.0f, 0.0f, 0.0f };
+
+			virtual void Update(float dt) override
+			{
+				position += velocity * dt;
+			}
+	};
+
+	// both declare what they touch, so the LogicSystem can update their buckets on the JobSystem
+	class SpinnerLogic : public LogicComponent
+	{
+		public:
+			using Writes = ComponentList<TransformationComponent>;
+
+			// only its own object's transformation
+			static constexpr bool INDEPENDENT_INSTANCES = true;
+
+			virtual void Update(float dt) override
+			{
+				GetOwner()->GetComponent<TransformationComponent>()->RotateAxis(dt, Rotation::VECTOR_UP);
+			}
+	};
+
+	class TrackerLogic : public LogicComponent
+	{
+		public:
+			using Reads = ComponentList<TransformationComponent>;
+
+			static constexpr bool INDEPENDENT_INSTANCES = true;
+
+			float distance = 0.0f;
+
+			virtual void Update(float dt) override
+			{
+				distance += glm::length(GetOwner()->GetComponent<TransformationComponent>()->GetWorldPosition()) * dt;
+			}
+	};
+
+	struct Position
+	{
+			glm::vec3 value { 0.0f };
+	};
+
+	struct Velocity
+	{
+			glm::vec3 value { 1.0f, 0.0f, 0.0f };
+	};
+
+	GameObject* NewTransformedObject(const std::string& name, GameObject* parent = nullptr)
+	{
+		GameObject* object
+			= parent != nullptr ? parent->NewChild(name) : GameObjectManager::GetInstance().NewGameObject(name);
+		object->AddComponent<TransformationComponent>();
+		object->Initialize();
+
+		return object;
+	}
+
+	void ClearScene()
+	{
+		GameObjectManager::GetInstance().Shutdown();
+		HierarchyManager::GetInstance().Update();
+	}
+
+	void ChurnBenchmark(BenchmarkRunner& runner)
+	{
+		// all with the same name, destroyed together like a burst of particles
+		constexpr size_t OBJECT_COUNT = 50000;
+
+		std::vector<GameObject*> objects;
+		objects.reserve(OBJECT_COUNT);
+
+		runner.Run("GameObject spawn and destroy", OBJECT_COUNT, [&]() {
+			for (size_t i = 0; i < OBJECT_COUNT; i++)
+			{
+				GameObject* object = NewTransformedObject("particle");
+				object->AddComponent<MoverLogic>();
+				objects.push_back(object);
+			}
+
+			for (GameObject* object : objects)
+			{
+				object->Shutdown();
+			}
+
+			GameObjectManager::GetInstance().Update();
+			objects.clear();
+		});
+	}
+
+	void HierarchyBenchmarks(BenchmarkRunner& runner)
+	{
+		constexpr size_t NODE_COUNT	   = 10000;
+		constexpr size_t UPDATE_COUNT = 20;
+
+		HierarchyManager& hierarchy = HierarchyManager::GetInstance();
+
+		// moves the roots and recomputes everything below them, once per update
+		auto update_roots = [&](const std::vector<GameObject*>& roots) {
+			for (size_t update = 0; update < UPDATE_COUNT; update++)
+			{
+				for (GameObject* root : roots)
+				{
+					root->GetComponent<TransformationComponent>()->RotateAxis(0.01f, Rotation::VECTOR_UP);
+				}
+
+				hierarchy.Update();
+			}
+		};
+
+		if (runner.IsSelected("Hierarchy deep update"))
+		{
+			// a single chain
+			std::vector<GameObject*> roots { NewTransformedObject("node") };
+
+			GameObject* last = roots.front();
+			for (size_t i = 1; i < NODE_COUNT; i++)
+			{
+				last = NewTransformedObject("node", last);
+				last->GetComponent<TransformationComponent>()->SetLocalPosition(glm::vec3 { 0.0f, 1.0f, 0.0f });
+			}
+			hierarchy.Update();
+
+			runner.Run("Hierarchy deep update", NODE_COUNT * UPDATE_COUNT, [&]() { update_roots(roots); });
+			ClearScene();
+		}
+
+		if (runner.IsSelected("Hierarchy wide update"))
+		{
+			// a single parent
+			std::vector<GameObject*> roots { NewTransformedObject("node") };
+			for (size_t i = 1; i < NODE_COUNT; i++)
+			{
+				NewTransformedObject("node", roots.front())
+					->GetComponent<TransformationComponent>()
+					->SetLocalPosition(glm::vec3 { static_cast<float>(i), 0.0f, 0.0f });
+			}
+			hierarchy.Update();
+
+			runner.Run("Hierarchy wide update", NODE_COUNT * UPDATE_COUNT, [&]() { update_roots(roots); });
+			ClearScene();
+		}
+
+		if (runner.IsSelected("Hierarchy forest update"))
+		{
+			// many small independent trees, the case the parallel update is meant for
+			std::vector<GameObject*> roots;
+			for (size_t i = 0; i < NODE_COUNT / 10; i++)
+			{
+				roots.push_back(NewTransformedObject("node"));
+				for (size_t j = 1; j < 10; j++)
+				{
+					NewTransformedObject("node", roots.back());
+				}
+			}
+			hierarchy.Update();
+
+			runner.Run("Hierarchy forest update", NODE_COUNT * UPDATE_COUNT, [&]() { update_roots(roots); });
+			ClearScene();
+		}
+	}
+
+	void NameLookupBenchmark(BenchmarkRunner& runner)
+	{
+		constexpr size_t OBJECT_COUNT = 10000;
+		constexpr size_t NAME_COUNT	  = 100;
+		constexpr size_t LOOKUP_COUNT = 10000;
+
+		if (runner.IsSelected("Name lookup") == false)
+		{
+			return;
+		}
+
+		std::vector<std::string> names;
+		for (size_t i = 0; i < NAME_COUNT; i++)
+		{
+			names.push_back("object " + std::to_string(i));
+		}
+
+		for (size_t i = 0; i < OBJECT_COUNT; i++)
+		{
+			GameObjectManager::GetInstance().NewGameObject(names[i % NAME_COUNT]);
+		}
+
+		size_t found = 0;
+		runner.Run("Name lookup", LOOKUP_COUNT, [&]() {
+			for (size_t i = 0; i < LOOKUP_COUNT; i++)
+			{
+				found += GameObject::FindObjectByName(names[i % NAME_COUNT]) != nullptr;
+			}
+		});
+
+		ClearScene();
+	}
+
+	void ConcatenateBenchmarks(BenchmarkRunner& runner)
+	{
+		constexpr size_t PAIR_COUNT = 100000;
+
+		std::mt19937						  random { 1234 };
+		std::uniform_real_distribution<float> distribution { -1.0f, 1.0f };
+
+		auto random_vector = [&]() {
+			return glm::vec3 { distribution(random), distribution(random), distribution(random) };
+		};
+
+		std::vector<Transformation> parents;
+		std::vector<Transformation> children;
+		std::vector<Transformation> results(PAIR_COUNT);
+
+		// with non-uniform scales, Concatenate() falls back to the matrices for most of the pairs
+		for (bool uniform_scale : { true, false })
+		{
+			parents.clear();
+			children.clear();
+
+			for (size_t i = 0; i < PAIR_COUNT; i++)
+			{
+				for (std::vector<Transformation>* transformations : { &parents, &children })
+				{
+					glm::vec3 axis = glm::normalize(random_vector() + Rotation::VECTOR_UP * 2.0f);
+					glm::vec3 scale = uniform_scale ? glm::vec3 { 1.0f + distribution(random) * 0.5f }
+													: glm::vec3 { 1.0f } + random_vector() * 0.5f;
+
+					Transformation transformation { random_vector() * 10.0f, scale };
+					transformation.rotation.RotateAxis(distribution(random) * 3.0f, axis);
+					transformations->push_back(transformation);
+				}
+			}
+
+			const std::string suffix = uniform_scale ? "" : " non-uniform";
+
+			runner.Run("Transformation Concatenate" + suffix, PAIR_COUNT, [&]() {
+				for (size_t i = 0; i < PAIR_COUNT; i++)
+				{
+					results[i] = parents[i].Concatenate(children[i]);
+				}
+			});
+
+			runner.Run("Transformation ConcatenateMatrices" + suffix, PAIR_COUNT, [&]() {
+				for (size_t i = 0; i < PAIR_COUNT; i++)
+				{
+					results[i] = parents[i].ConcatenateMatrices(children[i]);
+				}
+			});
+		}
+	}
+
+	void LogicBenchmarks(BenchmarkRunner& runner)
+	{
+		LogicSystem& logic = LogicSystem::GetInstance();
+
+		if (runner.IsSelected("LogicSystem mixed components"))
+		{
+			constexpr size_t COMPONENT_COUNT = 50000;
+
+			// interleaved, as they would be after spawning different kinds of objects
+			for (size_t i = 0; i < COMPONENT_COUNT; i++)
+			{
+				GameObject* object = GameObjectManager::GetInstance().NewGameObject("logic");
+				switch (i % 5)
+				{
+					case 0: object->AddComponent<MixedLogic<0>>(); break;
+					case 1: object->AddComponent<MixedLogic<1>>(); break;
+					case 2: object->AddComponent<MixedLogic<2>>(); break;
+					case 3: object->AddComponent<MixedLogic<3>>(); break;
+					default: object->AddComponent<MixedLogic<4>>(); break;
+				}
+				object->Initialize();
+			}
+			logic.Update(STEP);
+
+			runner.Run("LogicSystem mixed components", COMPONENT_COUNT, [&]() { logic.Update(STEP); });
+			ClearScene();
+		}
+
+		if (runner.IsSelected("LogicSystem declared access (serial)")
+			|| runner.IsSelected("LogicSystem declared access (parallel)"))
+		{
+			constexpr size_t OBJECT_COUNT = 20000;
+
+			HierarchyManager& hierarchy = HierarchyManager::GetInstance();
+
+			// spinning parents carrying a tracked child, the spinners move the children along
+			for (size_t i = 0; i < OBJECT_COUNT / 2; i++)
+			{
+				GameObject* parent = NewTransformedObject("spinner");
+				parent->AddComponent<SpinnerLogic>();
+
+				GameObject* child = NewTransformedObject("tracker", parent);
+				child->GetComponent<TransformationComponent>()->SetLocalPosition(glm::vec3 { 1.0f, 0.0f, 0.0f });
+				child->AddComponent<TrackerLogic>();
+			}
+			logic.Update(STEP);
+			hierarchy.Update();
+
+			// the transformations moved in parallel are only propagated by the hierarchy
+			auto step = [&]() {
+				logic.Update(STEP);
+				hierarchy.Update();
+			};
+
+			logic.SetParallelUpdate(false);
+			runner.Run("LogicSystem declared access (serial)", OBJECT_COUNT, step);
+
+			logic.SetParallelUpdate(true);
+			runner.Run("LogicSystem declared access (parallel)", OBJECT_COUNT, step);
+
+			ClearScene();
+		}
+
+		// the same work through both object models
+		constexpr size_t ENTITY_COUNT = 100000;
+
+		if (runner.IsSelected("Movers as LogicComponents"))
+		{
+			for (size_t i = 0; i < ENTITY_COUNT; i++)
+			{
+				GameObject* object = GameObjectManager::GetInstance().NewGameObject("mover");
+				object->AddComponent<MoverLogic>();
+				object->Initialize();
+			}
+			logic.Update(STEP);
+
+			runner.Run("Movers as LogicComponents", ENTITY_COUNT, [&]() { logic.Update(STEP); });
+			ClearScene();
+		}
+
+		if (runner.IsSelected("Movers as ECS entities"))
+		{
+			World& world = World::GetInstance();
+			for (size_t i = 0; i < ENTITY_COUNT; i++)
+			{
+				world.CreateEntity(Position {}, Velocity {});
+			}
+
+			// stepped like the LogicSystem, through a system
+			Query<Position, Velocity> movers = world.CreateQuery<Position, Velocity>();
+			world.AddSystem([&movers](World&, float dt) {
+				movers.Each([dt](Position& position, const Velocity& velocity) {
+					position.value += velocity.value * dt;
+				});
+			});
+
+			runner.Run("Movers as ECS entities", ENTITY_COUNT, [&]() { world.Update(STEP); });
+
+			world.Shutdown();
+		}
+	}
+} // namespace
+
+void RunSceneBenchmarks(BenchmarkRunner& runner)
+{
+	ChurnBenchmark(runner);
+	HierarchyBenchmarks(runner);
+	NameLookupBenchmark(runner);
+	ConcatenateBenchmarks(runner);
+	LogicBenchmarks(runner);
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "Benchmark.hpp"
+#include <Utils/JobSystem.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+	void PrintUsage()
+	{
+		std::cout << "PSXBenchmarks [options]\n"
+				  << "  --filter <text>       only run the benchmarks whose name contains the text\n"
+				  << "  --repetitions <n>     measured runs per benchmark, the fastest is kept (default 5)\n"
+				  << "  --workers <n>         job system workers, 0 runs everything on this thread (default 0)\n"
+				  << "  --data <directory>    where the meshes and images are found (default data)\n"
+				  << "  --output <file>       save the results as JSON\n"
+				  << "  --baseline <file>     compare against previously saved results, fails on regressions\n"
+				  << "  --tolerance <ratio>   slowdown allowed by the comparison (default 0.1)" << std::endl;
+	}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	std::string filter;
+	std::string data_directory = "data";
+	std::string output;
+	std::string baseline;
+	size_t		repetitions	   = 5;
+	unsigned	workers		   = 0;
+	double		tolerance	   = 0.1;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string argument = argv[i];
+
+		if (argument == "--help")
+		{
+			PrintUsage();
+			return 0;
+		}
+
+		// every other option takes a value
+		if (i + 1 >= argc)
+		{
+			PrintUsage();
+			return 1;
+		}
+
+		const std::string value = argv[++i];
+
+		if (argument == "--filter")
+			filter = value;
+		else if (argument == "--repetitions")
+			repetitions = std::strtoul(value.c_str(), nullptr, 10);
+		else if (argument == "--workers")
+			workers = static_cast<unsigned>(std::strtoul(value.c_str(), nullptr, 10));
+		else if (argument == "--data")
+			data_directory = value;
+		else if (argument == "--output")
+			output = value;
+		else if (argument == "--baseline")
+			baseline = value;
+		else if (argument == "--tolerance")
+			tolerance = std::strtod(value.c_str(), nullptr);
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	// without workers the job system runs every job right away, which keeps the numbers stable
+	if (workers > 0)
+	{
+		JobSystem::GetInstance().Initialize(workers);
+	}
+
+	BenchmarkRunner runner { filter, repetitions };
+
+	RunSceneBenchmarks(runner);
+	RunResourceBenchmarks(runner, data_directory);
+
+	JobSystem::GetInstance().Shutdown();
+
+	runner.Print();
+
+	if (output.empty() == false)
+	{
+		runner.Save(output);
+	}
+
+	if (baseline.empty() == false && runner.CompareWithBaseline(baseline, tolerance) == false)
+	{
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
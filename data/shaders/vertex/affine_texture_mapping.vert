@@ -6,6 +6,10 @@ layout(location = 1) in vec3 vertex_color;
 layout(location = 2) in vec2 vertex_textureCoordinates;
 layout(location = 3) in vec3 vertex_normal;
 
+// constant per model, packed models store their positions between the bounds (see Model::Render())
+layout(location = 4) in vec3 position_offset;
+layout(location = 5) in vec3 position_scale;
+
 // for the fragment shader
 out vec3 fragment_view_position;
 out vec3 fragment_color;
@@ -22,7 +26,9 @@ layout(location = 3) uniform bool usingAffineTextureMapping;
 
 void main()
 {		
-	vec4 view_position = view_matrix * model_matrix * vec4(vertex_position, 1.0);
+	vec3 position = position_offset + vertex_position * position_scale;
+
+	vec4 view_position = view_matrix * model_matrix * vec4(position, 1.0);
 	fragment_view_position = view_position.xyz;
 	gl_Position = projection_matrix * vec4(floor(view_position.xyz), 1.0);
 
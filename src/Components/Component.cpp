@@ -1,13 +1,15 @@
 #include "Component.hpp"
 #include <GameObject/GameObject.hpp>
+#include <GameObject/GameObjectManager.hpp>
 
 Component::Component()
-	: mOwner { nullptr }
+	: mOwner {}, mHandle { handle_table.Add(this) }, mTypeInfo { nullptr }
 {
 }
 
 Component::~Component()
 {
+	handle_table.Remove(mHandle);
 }
 
 void Component::AddToSystem()
@@ -43,14 +45,39 @@ void Component::ShutdownEvents()
 
 GameObject* Component::GetOwner() const
 {
-	return mOwner;
+	return GameObjectManager::GetInstance().Resolve(mOwner);
+}
+
+ComponentTypeID Component::GetTypeID() const
+{
+	return mTypeInfo != nullptr ? mTypeInfo->id : TypeID<Component>::INVALID;
+}
+
+const ComponentTypeInfo* Component::GetTypeInfo() const
+{
+	return mTypeInfo;
+}
+
+ComponentHandle Component::GetHandle() const
+{
+	return mHandle;
+}
+
+Component* Component::Resolve(ComponentHandle handle)
+{
+	return handle_table.Resolve(handle);
+}
+
+void Component::Relocate(ComponentHandle handle, Component* component)
+{
+	handle_table.Relocate(handle, component);
 }
 
 void Component::Destroy()
 {
-	if (mOwner != nullptr)
+	if (GameObject* owner = GetOwner())
 	{
-		mOwner->RemoveComponent(this);
+		owner->RemoveComponent(this);
 	}
 	else
 	{
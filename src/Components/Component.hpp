@@ -1,12 +1,28 @@
 #ifndef COMPONENT_HPP
 #define COMPONENT_HPP
 
+#include "ComponentType.hpp"
+#include <Memory/MemoryTracker.hpp>
+#include <Utils/Handle.hpp>
+#include <concepts>
+
+class Component;
 class GameObject;
 
+using ComponentHandle  = Handle<Component>;
+using GameObjectHandle = Handle<GameObject>;
+
 class Component
 {
 		friend class GameObject;
-		GameObject* mOwner;
+		GameObjectHandle mOwner;
+		ComponentHandle	 mHandle;
+
+		// every live component, so that stale handles resolve to null
+		static inline HandleTable<Component> handle_table;
+
+		// exact type of the component, only known when added through GameObject::AddComponent<T>()
+		const ComponentTypeInfo* mTypeInfo;
 
 	public:
 		Component();
@@ -26,13 +42,30 @@ class Component
 		
 		virtual void Edit();
 
-		GameObject* GetOwner() const;
-		void		Destroy();
+		GameObject*				 GetOwner() const;
+		ComponentTypeID			 GetTypeID() const;
+		const ComponentTypeInfo* GetTypeInfo() const;
+		ComponentHandle			 GetHandle() const;
+		void					 Destroy();
+
+		// null once the component has been released
+		static Component* Resolve(ComponentHandle handle);
+
+		// keeps the handles valid when a component is moved to another address
+		static void Relocate(ComponentHandle handle, Component* component);
 
 		template <typename T>
 		T* GetComponent() const;
 };
 
+// components are pooled by GameObject::AddComponent<T>()
+template <typename T>
+	requires std::derived_from<T, Component>
+struct MemoryTagOf<T>
+{
+		static constexpr MemoryTag value = MemoryTag::Components;
+};
+
 #include "Component.inl"
 
 #endif
\ No newline at end of file
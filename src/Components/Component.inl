@@ -4,5 +4,5 @@
 template <typename T>
 T* Component::GetComponent() const
 {
-	return mOwner->GetComponent<T>();
+	return GetOwner()->GetComponent<T>();
 }
\ No newline at end of file
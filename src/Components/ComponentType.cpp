@@ -0,0 +1,35 @@
+#include "ComponentType.hpp"
+
+namespace
+{
+	bool Intersects(const std::vector<ComponentTypeID>& a, const std::vector<ComponentTypeID>& b)
+	{
+		// both are sorted
+		std::vector<ComponentTypeID>::const_iterator it_a = a.begin();
+		std::vector<ComponentTypeID>::const_iterator it_b = b.begin();
+
+		while (it_a != a.end() && it_b != b.end())
+		{
+			if (*it_a < *it_b)
+			{
+				it_a++;
+			}
+			else if (*it_b < *it_a)
+			{
+				it_b++;
+			}
+			else
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+bool ComponentAccess::ConflictsWith(const ComponentAccess& other) const
+{
+	// reading the same data concurrently is fine, anything involving a write is not
+	return Intersects(writes, other.writes) || Intersects(writes, other.reads) || Intersects(reads, other.writes);
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef COMPONENTTYPE_HPP
+#define COMPONENTTYPE_HPP
+
+#include <Utils/TypeID.hpp>
+#include <cstddef>
+#include <vector>
+
+class Component;
+class LogicComponent;
+
+// ids are only meaningful within the Component family, see TypeID<Component>
+using ComponentTypeID = uint32_t;
+
+// updates a whole bucket of components of the same concrete type, see LogicSystem
+// entries may be null (components removed during the update)
+using LogicBatchUpdate = void (*)(LogicComponent* const* components, size_t count, float dt);
+
+// the part of a bucket handed to T::UpdateBatch(LogicBatch<T>, float), read straight from the bucket
+// so a component removed during the update (by the hook itself too) shows up as null, never dangling
+template <typename T>
+class LogicBatch
+{
+		LogicComponent* const* mComponents;
+		size_t				   mCount;
+
+	public:
+		LogicBatch(LogicComponent* const* components, size_t count);
+
+		size_t GetSize() const;
+
+		// null once the component has been removed
+		T* operator[](size_t index) const;
+};
+
+// component types a LogicComponent touches in its Update(dt), declared in the class as
+//     using Reads  = ComponentList<TransformationComponent>;
+//     using Writes = ComponentList<OtherComponent>;
+// a type always writes itself; types declaring neither are updated serially
+// this only orders different types, the components of one type are still updated one after the other
+// unless the type also declares
+//     static constexpr bool INDEPENDENT_INSTANCES = true;
+// promising that each component only touches what its own object owns (a follower reading the transformation
+// of another object and writing its own would break it), then its bucket is split between the workers too
+template <typename... Ts>
+struct ComponentList
+{
+};
+
+// sorted ids of the declared lists
+struct ComponentAccess
+{
+		std::vector<ComponentTypeID> reads;
+		std::vector<ComponentTypeID> writes;
+
+		// INDEPENDENT_INSTANCES, the bucket may be split
+		bool independent_instances = false;
+
+		bool ConflictsWith(const ComponentAccess& other) const;
+};
+
+// filled in once per concrete type by GameObject::AddComponent<T>()
+struct ComponentTypeInfo
+{
+		ComponentTypeID id;
+
+		// destroys the component and returns its memory to the pool it came from
+		void (*destroy)(Component* component);
+
+		// only for LogicComponent types: calls T::UpdateBatch(LogicBatch<T>, float) if the type declares one,
+		// otherwise T::Update(float) on each component without going through the vtable
+		LogicBatchUpdate update_batch;
+
+		// null unless the type declares Reads or Writes
+		const ComponentAccess* access;
+};
+
+template <typename T>
+const ComponentTypeInfo& GetComponentTypeInfo();
+
+#include "ComponentType.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "ComponentType.hpp"
+#include <Memory/PoolAllocator.hpp>
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+template <typename T>
+void DestroyPooledComponent(Component* component)
+{
+	PoolAllocator<T>::GetInstance().Delete(static_cast<T*>(component));
+}
+
+template <typename T>
+LogicBatch<T>::LogicBatch(LogicComponent* const* components, size_t count)
+	: mComponents { components }, mCount { count }
+{
+}
+
+template <typename T>
+size_t LogicBatch<T>::GetSize() const
+{
+	return mCount;
+}
+
+template <typename T>
+T* LogicBatch<T>::operator[](size_t index) const
+{
+	return static_cast<T*>(mComponents[index]);
+}
+
+template <typename T>
+concept HasUpdateBatch = requires(LogicBatch<T> batch, float dt) { T::UpdateBatch(batch, dt); };
+
+template <typename T>
+void UpdateLogicBatch(LogicComponent* const* components, size_t count, float dt)
+{
+	if constexpr (HasUpdateBatch<T>)
+	{
+		// no copy of the pointers, the hook sees the removals as they happen
+		T::UpdateBatch(LogicBatch<T> { components, count }, dt);
+	}
+	else
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			if (components[i] != nullptr)
+			{
+				// qualified call, resolved at compile time
+				static_cast<T*>(components[i])->T::Update(dt);
+			}
+		}
+	}
+}
+
+template <typename T>
+LogicBatchUpdate GetLogicBatchUpdate()
+{
+	if constexpr (std::is_base_of_v<LogicComponent, T>)
+	{
+		return &UpdateLogicBatch<T>;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+template <typename T>
+concept DeclaresComponentAccess = requires { typename T::Reads; } || requires { typename T::Writes; };
+
+template <typename... Ts>
+void AppendComponentListIDs(std::vector<ComponentTypeID>& ids, ComponentList<Ts...>)
+{
+	(ids.push_back(TypeID<Component>::Get<Ts>()), ...);
+}
+
+template <typename T>
+ComponentAccess BuildComponentAccess()
+{
+	ComponentAccess access;
+
+	if constexpr (requires { typename T::Reads; })
+	{
+		AppendComponentListIDs(access.reads, typename T::Reads {});
+	}
+
+	if constexpr (requires { typename T::Writes; })
+	{
+		AppendComponentListIDs(access.writes, typename T::Writes {});
+	}
+
+	access.writes.push_back(TypeID<Component>::Get<T>());
+
+	if constexpr (requires { T::INDEPENDENT_INSTANCES; })
+	{
+		access.independent_instances = T::INDEPENDENT_INSTANCES;
+	}
+
+	for (std::vector<ComponentTypeID>* ids : { &access.reads, &access.writes })
+	{
+		std::sort(ids->begin(), ids->end());
+		ids->erase(std::unique(ids->begin(), ids->end()), ids->end());
+	}
+
+	return access;
+}
+
+template <typename T>
+const ComponentAccess* GetComponentAccess()
+{
+	if constexpr (DeclaresComponentAccess<T>)
+	{
+		static const ComponentAccess access = BuildComponentAccess<T>();
+		return &access;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+template <typename T>
+const ComponentTypeInfo& GetComponentTypeInfo()
+{
+	static const ComponentTypeInfo info {
+		TypeID<Component>::Get<T>(),
+		&DestroyPooledComponent<T>,
+		GetLogicBatchUpdate<T>(),
+		GetComponentAccess<T>(),
+	};
+
+	return info;
+}
\ No newline at end of file
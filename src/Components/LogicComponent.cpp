@@ -1,6 +1,11 @@
 #include "LogicComponent.hpp"
 #include "LogicSystem.hpp"
 
+LogicComponent::LogicComponent()
+	: mBucketIndex { LogicSystem::INVALID_INDEX }, mSystemIndex { LogicSystem::INVALID_INDEX }
+{
+}
+
 LogicComponent::~LogicComponent()
 {
 }
@@ -29,4 +34,12 @@ void LogicComponent::Shutdown()
 
 void LogicComponent::OnDestroy()
 {
+}
+
+void LogicComponent::Update()
+{
+}
+
+void LogicComponent::Update(float)
+{
 }
\ No newline at end of file
@@ -5,18 +5,31 @@
 
 class LogicComponent : public Component
 {
+		friend class LogicSystem;
+
+		// bucket and position inside of it in the LogicSystem, INVALID_INDEX while not registered
+		int mBucketIndex;
+		int mSystemIndex;
+
 		virtual void AddToSystem() final override;
 		virtual void RemoveFromSystem() final override;
 		virtual void Create() final override;
 		virtual void Shutdown() final override;
 
+		// logic goes in Update(dt), sealed so that an override of the old signature fails to compile
+		// instead of silently never being called
+		virtual void Update() final override;
+
 	public:
+		LogicComponent();
 		virtual ~LogicComponent() = 0;
 
 		using Component::Initialize;
-		using Component::Update;
 		using Component::ShutdownEvents;
 		virtual void OnDestroy();
+
+		// called by the LogicSystem once per simulation step, dt is the fixed step duration in seconds
+		virtual void Update(float dt);
 };
 
 #endif
\ No newline at end of file
@@ -1,17 +1,242 @@
 #include "LogicSystem.hpp"
 #include "LogicComponent.hpp"
+#include <Profiling/Profiler.hpp>
+#include <Transformation/HierarchyManager.hpp>
+#include <Utils/JobSystem.hpp>
+#include <algorithm>
+#include <cassert>
 
-void LogicSystem::Update()
+void LogicSystem::Update(float dt)
 {
-	for (LogicComponent* component : mLogicComponents)
+	PROFILE_ZONE("LogicSystem");
+
+	mUpdating = true;
+
+	const size_t bucket_count = mBuckets.size();
+	mScheduled.assign(bucket_count, 0);
+
+	for (size_t i = 0; i < bucket_count; i++)
+	{
+		if (mScheduled[i])
+		{
+			continue;
+		}
+
+		Bucket& bucket = mBuckets[i];
+
+		// may touch anything, runs on its own
+		if (!mParallelUpdate || bucket.access == nullptr)
+		{
+			UpdateBucket(bucket, 0, bucket.components.size(), dt);
+			mScheduled[i] = 1;
+			continue;
+		}
+
+		BuildPhase(static_cast<int>(i));
+		RunPhase(dt);
+	}
+
+	mUpdating = false;
+
+	CompactBuckets();
+
+	// they will be updated from the next step on
+	for (LogicComponent* component : mPendingComponents)
 	{
-		component->Update();
+		Insert(component);
 	}
+	mPendingComponents.clear();
+}
+
+void LogicSystem::UpdateBucket(Bucket& bucket, size_t begin, size_t end, float dt)
+{
+	LogicComponent* const* components = bucket.components.data() + begin;
+
+	if (bucket.update != nullptr)
+	{
+		bucket.update(components, end - begin, dt);
+		return;
+	}
+
+	for (size_t i = 0; i < end - begin; i++)
+	{
+		if (components[i] != nullptr)
+		{
+			components[i]->Update(dt);
+		}
+	}
+}
+
+void LogicSystem::BuildPhase(int first_bucket)
+{
+	mPhase.clear();
+	mDeferred.clear();
+
+	for (int i = first_bucket; i < static_cast<int>(mBuckets.size()); i++)
+	{
+		if (mScheduled[i])
+		{
+			continue;
+		}
+
+		const ComponentAccess* access = mBuckets[i].access;
+
+		// nothing can be moved ahead of a bucket that may touch anything
+		if (access == nullptr)
+		{
+			break;
+		}
+
+		// it also has to stay behind the earlier buckets it conflicts with
+		bool conflicts = false;
+		for (int other : mPhase)
+		{
+			conflicts = conflicts || access->ConflictsWith(*mBuckets[other].access);
+		}
+		for (int other : mDeferred)
+		{
+			conflicts = conflicts || access->ConflictsWith(*mBuckets[other].access);
+		}
+
+		if (conflicts)
+		{
+			mDeferred.push_back(i);
+		}
+		else
+		{
+			mPhase.push_back(i);
+			mScheduled[i] = 1;
+		}
+	}
+}
+
+void LogicSystem::RunPhase(float dt)
+{
+	PROFILE_ZONE("LogicSystem phase");
+
+	mWorkItems.clear();
+
+	for (int bucket : mPhase)
+	{
+		const size_t size = mBuckets[bucket].components.size();
+
+		// components of the same type may depend on each other unless the type says otherwise
+		if (mBuckets[bucket].access->independent_instances == false)
+		{
+			mWorkItems.push_back(WorkItem { bucket, 0, size });
+			continue;
+		}
+
+		for (size_t begin = 0; begin < size; begin += PARALLEL_GRAIN)
+		{
+			mWorkItems.push_back(WorkItem { bucket, begin, std::min(begin + PARALLEL_GRAIN, size) });
+		}
+	}
+
+	HierarchyManager& hierarchy = HierarchyManager::GetInstance();
+
+	// the transformations moved by the phase are propagated by the next HierarchyManager::Update()
+	mInParallelPhase = true;
+	hierarchy.SetDeferredUpdates(true);
+
+	JobSystem::GetInstance().ParallelFor(mWorkItems.size(), 1, [this, dt](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; i++)
+		{
+			const WorkItem& item = mWorkItems[i];
+			UpdateBucket(mBuckets[item.bucket], item.begin, item.end, dt);
+		}
+	});
+
+	hierarchy.SetDeferredUpdates(false);
+	mInParallelPhase = false;
 }
 
 void LogicSystem::Shutdown()
 {
-	mLogicComponents.clear();
+	for (Bucket& bucket : mBuckets)
+	{
+		for (LogicComponent* component : bucket.components)
+		{
+			if (component != nullptr)
+			{
+				component->mBucketIndex = INVALID_INDEX;
+				component->mSystemIndex = INVALID_INDEX;
+			}
+		}
+	}
+
+	for (LogicComponent* component : mPendingComponents)
+	{
+		component->mSystemIndex = INVALID_INDEX;
+	}
+
+	mBuckets.clear();
+	mBucketIndices.clear();
+	mGenericBucketIndex = INVALID_INDEX;
+	mPendingComponents.clear();
+}
+
+int LogicSystem::GetBucketIndex(LogicComponent* component)
+{
+	const ComponentTypeInfo* type_info = component->GetTypeInfo();
+
+	// no way to update it without the vtable
+	if (type_info == nullptr || type_info->update_batch == nullptr)
+	{
+		if (mGenericBucketIndex == INVALID_INDEX)
+		{
+			mGenericBucketIndex = static_cast<int>(mBuckets.size());
+			mBuckets.emplace_back();
+		}
+
+		return mGenericBucketIndex;
+	}
+
+	if (type_info->id >= mBucketIndices.size())
+	{
+		mBucketIndices.resize(type_info->id + 1, INVALID_INDEX);
+	}
+
+	int& bucket_index = mBucketIndices[type_info->id];
+	if (bucket_index == INVALID_INDEX)
+	{
+		bucket_index = static_cast<int>(mBuckets.size());
+		Bucket& bucket = mBuckets.emplace_back();
+		bucket.update  = type_info->update_batch;
+		bucket.access  = type_info->access;
+	}
+
+	return bucket_index;
+}
+
+void LogicSystem::Insert(LogicComponent* component)
+{
+	int		bucket_index = GetBucketIndex(component);
+	Bucket& bucket		 = mBuckets[bucket_index];
+
+	component->mBucketIndex = bucket_index;
+	component->mSystemIndex = static_cast<int>(bucket.components.size());
+	bucket.components.push_back(component);
+}
+
+void LogicSystem::CompactBuckets()
+{
+	for (Bucket& bucket : mBuckets)
+	{
+		if (!bucket.has_holes)
+		{
+			continue;
+		}
+
+		std::erase(bucket.components, nullptr);
+
+		for (size_t i = 0; i < bucket.components.size(); i++)
+		{
+			bucket.components[i]->mSystemIndex = static_cast<int>(i);
+		}
+
+		bucket.has_holes = false;
+	}
 }
 
 void LogicSystem::AddComponent(LogicComponent* component)
@@ -21,18 +246,76 @@ void LogicSystem::AddComponent(LogicComponent* component)
 		return;
 	}
 
-	if (std::find(mLogicComponents.begin(), mLogicComponents.end(), component) == mLogicComponents.end())
+	// the buckets are not guarded, see the class comment
+	assert(!mInParallelPhase && "components cannot be added from a parallel logic phase");
+
+	// already registered
+	if (component->mSystemIndex != INVALID_INDEX)
 	{
-		mLogicComponents.push_back(component);
+		return;
 	}
+
+	if (mUpdating)
+	{
+		component->mSystemIndex = PENDING_INDEX;
+		mPendingComponents.push_back(component);
+		return;
+	}
+
+	Insert(component);
 }
 
 void LogicSystem::RemoveComponent(LogicComponent* component)
 {
-	if (component == nullptr)
+	if (component == nullptr || component->mSystemIndex == INVALID_INDEX)
 	{
 		return;
 	}
 
-	mLogicComponents.remove(component);
+	assert(!mInParallelPhase && "components cannot be removed from a parallel logic phase");
+
+	if (component->mSystemIndex == PENDING_INDEX)
+	{
+		std::erase(mPendingComponents, component);
+		component->mSystemIndex = INVALID_INDEX;
+		return;
+	}
+
+	Bucket& bucket = mBuckets[component->mBucketIndex];
+	int		index  = component->mSystemIndex;
+
+	if (mUpdating)
+	{
+		// the bucket may be being iterated right now
+		bucket.components[index] = nullptr;
+		bucket.has_holes		 = true;
+	}
+	else
+	{
+		// swap and pop
+		LogicComponent* last = bucket.components.back();
+
+		bucket.components[index] = last;
+		last->mSystemIndex		 = index;
+
+		bucket.components.pop_back();
+	}
+
+	component->mBucketIndex = INVALID_INDEX;
+	component->mSystemIndex = INVALID_INDEX;
+}
+
+void LogicSystem::SetParallelUpdate(bool enabled)
+{
+	mParallelUpdate = enabled;
+}
+
+bool LogicSystem::GetParallelUpdate() const
+{
+	return mParallelUpdate;
+}
+
+bool LogicSystem::IsInParallelPhase() const
+{
+	return mInParallelPhase;
 }
\ No newline at end of file
@@ -2,20 +2,88 @@
 #define LOGICSYSTEM_HPP
 
 #include <Utils/Singleton.hpp>
-#include <list>
+#include <Components/ComponentType.hpp>
+#include <cstdint>
+#include <vector>
 
 class LogicComponent;
 
+// components are grouped by concrete type and every group is updated in one tight loop
+// groups whose type declares its component access (see ComponentList) are gathered into phases of
+// non-conflicting groups that run on the JobSystem, split further only for INDEPENDENT_INSTANCES types;
+// the others run serially, in registration order
+// a type updated in parallel must only touch the components it declares, and must not create or
+// destroy objects or components, nor change parents, from its Update(dt)
+// while a parallel phase runs, transformations only record their local changes (see HierarchyManager)
 class LogicSystem : public Singleton<LogicSystem>
 {
-		std::list<LogicComponent*> mLogicComponents;
+		struct Bucket
+		{
+				// null for the generic bucket, which holds components added without type information
+				LogicBatchUpdate update = nullptr;
+
+				// null when the type did not declare what it touches
+				const ComponentAccess* access = nullptr;
+
+				// dense, every component knows its own position (LogicComponent::mSystemIndex)
+				// removing a component during the update leaves a null hole, compacted afterwards
+				std::vector<LogicComponent*> components;
+				bool						 has_holes = false;
+		};
+
+		std::vector<Bucket> mBuckets;
+
+		// component type id -> bucket, INVALID_INDEX if none yet
+		std::vector<int> mBucketIndices;
+		int				 mGenericBucketIndex = INVALID_INDEX;
+
+		// buckets cannot grow while they are being iterated, components added during the update wait here
+		std::vector<LogicComponent*> mPendingComponents;
+		bool						 mUpdating = false;
+
+		// set while the buckets of a phase are updated on the JobSystem
+		bool mInParallelPhase = false;
+
+		// a slice of a bucket (the whole of it unless its instances are independent), the unit of work of the
+		// parallel update
+		struct WorkItem
+		{
+				int	   bucket;
+				size_t begin;
+				size_t end;
+		};
+
+		bool				  mParallelUpdate = true;
+		std::vector<uint8_t>  mScheduled;
+		std::vector<int>	  mPhase;
+		std::vector<int>	  mDeferred;
+		std::vector<WorkItem> mWorkItems;
+
+		int	 GetBucketIndex(LogicComponent* component);
+		void Insert(LogicComponent* component);
+		void CompactBuckets();
+
+		void UpdateBucket(Bucket& bucket, size_t begin, size_t end, float dt);
+		void BuildPhase(int first_bucket);
+		void RunPhase(float dt);
 
 	public:
-		void Update();
+		static constexpr int	INVALID_INDEX  = -1;
+		static constexpr int	PENDING_INDEX  = -2;
+		static constexpr size_t PARALLEL_GRAIN = 64;
+
+		// runs one simulation step of dt seconds
+		void Update(float dt);
 		void Shutdown();
 
 		void AddComponent(LogicComponent* component);
 		void RemoveComponent(LogicComponent* component);
+
+		// when disabled, every bucket runs serially on the calling thread
+		void SetParallelUpdate(bool enabled);
+		bool GetParallelUpdate() const;
+
+		bool IsInParallelPhase() const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include "Archetype.hpp"
+#include <algorithm>
+
+Archetype::Archetype(const std::vector<const ColumnTypeInfo*>& sorted_types)
+{
+	mSignature.reserve(sorted_types.size());
+	mColumns.reserve(sorted_types.size());
+
+	for (const ColumnTypeInfo* type_info : sorted_types)
+	{
+		mSignature.push_back(type_info->id);
+		mColumns.emplace_back(*type_info);
+	}
+}
+
+Entity Archetype::RemoveRow(size_t row)
+{
+	for (Column& column : mColumns)
+	{
+		column.SwapAndPop(row);
+	}
+
+	size_t last = mEntities.size() - 1;
+	Entity moved {};
+
+	if (row != last)
+	{
+		mEntities[row] = mEntities[last];
+		moved		   = mEntities[row];
+	}
+
+	mEntities.pop_back();
+
+	return moved;
+}
+
+int Archetype::FindColumn(ColumnTypeID type_id) const
+{
+	std::vector<ColumnTypeID>::const_iterator it = std::lower_bound(mSignature.begin(), mSignature.end(), type_id);
+	if (it == mSignature.end() || *it != type_id)
+	{
+		return INVALID_COLUMN;
+	}
+
+	return static_cast<int>(it - mSignature.begin());
+}
+
+bool Archetype::Contains(const std::vector<ColumnTypeID>& sorted_type_ids) const
+{
+	return std::includes(mSignature.begin(), mSignature.end(), sorted_type_ids.begin(), sorted_type_ids.end());
+}
+
+Column& Archetype::GetColumn(int column)
+{
+	return mColumns[column];
+}
+
+const std::vector<ColumnTypeID>& Archetype::GetSignature() const
+{
+	return mSignature;
+}
+
+const std::vector<Entity>& Archetype::GetEntities() const
+{
+	return mEntities;
+}
+
+size_t Archetype::GetSize() const
+{
+	return mEntities.size();
+}
\ No newline at end of file
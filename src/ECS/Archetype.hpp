@@ -0,0 +1,42 @@
+#ifndef ARCHETYPE_HPP
+#define ARCHETYPE_HPP
+
+#include "Column.hpp"
+#include "Entity.hpp"
+#include <unordered_map>
+#include <vector>
+
+// every entity with exactly the same set of component types, one column per type
+// row i of every column (and of the entity array) belongs to the same entity
+class Archetype
+{
+		friend class World;
+
+		// sorted, columns are stored in the same order
+		std::vector<ColumnTypeID> mSignature;
+		std::vector<Column>		  mColumns;
+		std::vector<Entity>		  mEntities;
+
+		// archetypes reached by adding or removing one type, filled lazily by the World
+		std::unordered_map<ColumnTypeID, Archetype*> mAddTransitions;
+		std::unordered_map<ColumnTypeID, Archetype*> mRemoveTransitions;
+
+		// removes the row from every column, the last row takes its place
+		// returns the entity that was moved into the row (null if it was the last one)
+		Entity RemoveRow(size_t row);
+
+	public:
+		static constexpr int INVALID_COLUMN = -1;
+
+		explicit Archetype(const std::vector<const ColumnTypeInfo*>& sorted_types);
+
+		int	 FindColumn(ColumnTypeID type_id) const;
+		bool Contains(const std::vector<ColumnTypeID>& sorted_type_ids) const;
+
+		Column&							 GetColumn(int column);
+		const std::vector<ColumnTypeID>& GetSignature() const;
+		const std::vector<Entity>&		 GetEntities() const;
+		size_t							 GetSize() const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "Column.hpp"
+#include <algorithm>
+#include <new>
+
+Column::Column(const ColumnTypeInfo& type_info)
+	: mTypeInfo { &type_info }, mData { nullptr }, mSize { 0 }, mCapacity { 0 }
+{
+}
+
+Column::~Column()
+{
+	Clear();
+
+	if (mData != nullptr)
+	{
+		::operator delete(mData, std::align_val_t { mTypeInfo->alignment });
+	}
+}
+
+Column::Column(Column&& other) noexcept
+	: mTypeInfo { other.mTypeInfo }, mData { other.mData }, mSize { other.mSize }, mCapacity { other.mCapacity }
+{
+	other.mData		= nullptr;
+	other.mSize		= 0;
+	other.mCapacity = 0;
+}
+
+void Column::Reserve(size_t capacity)
+{
+	if (capacity <= mCapacity)
+	{
+		return;
+	}
+
+	std::byte* data = static_cast<std::byte*>(
+		::operator new(capacity * mTypeInfo->size, std::align_val_t { mTypeInfo->alignment }));
+
+	// values are moved one by one, they may not be trivially relocatable
+	for (size_t row = 0; row < mSize; row++)
+	{
+		void* source = mData + row * mTypeInfo->size;
+		mTypeInfo->move_construct(data + row * mTypeInfo->size, source);
+		mTypeInfo->destroy(source);
+	}
+
+	if (mData != nullptr)
+	{
+		::operator delete(mData, std::align_val_t { mTypeInfo->alignment });
+	}
+
+	mData	  = data;
+	mCapacity = capacity;
+}
+
+void* Column::PushBackDefault()
+{
+	if (mSize == mCapacity)
+	{
+		Reserve(std::max<size_t>(mCapacity * 2, 16));
+	}
+
+	void* value = mData + mSize * mTypeInfo->size;
+	mTypeInfo->default_construct(value);
+	mSize++;
+
+	return value;
+}
+
+void* Column::PushBackMoved(void* source)
+{
+	if (mSize == mCapacity)
+	{
+		Reserve(std::max<size_t>(mCapacity * 2, 16));
+	}
+
+	void* value = mData + mSize * mTypeInfo->size;
+	mTypeInfo->move_construct(value, source);
+	mSize++;
+
+	return value;
+}
+
+void Column::SwapAndPop(size_t row)
+{
+	size_t last = mSize - 1;
+
+	if (row != last)
+	{
+		void* hole = (*this)[row];
+		mTypeInfo->destroy(hole);
+		mTypeInfo->move_construct(hole, (*this)[last]);
+	}
+
+	mTypeInfo->destroy((*this)[last]);
+	mSize--;
+}
+
+void Column::Clear()
+{
+	for (size_t row = 0; row < mSize; row++)
+	{
+		mTypeInfo->destroy((*this)[row]);
+	}
+
+	mSize = 0;
+}
+
+void* Column::operator[](size_t row)
+{
+	return mData + row * mTypeInfo->size;
+}
+
+const void* Column::operator[](size_t row) const
+{
+	return mData + row * mTypeInfo->size;
+}
+
+void* Column::GetData()
+{
+	return mData;
+}
+
+size_t Column::GetSize() const
+{
+	return mSize;
+}
+
+const ColumnTypeInfo& Column::GetTypeInfo() const
+{
+	return *mTypeInfo;
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef COLUMN_HPP
+#define COLUMN_HPP
+
+#include "ColumnType.hpp"
+#include <cstddef>
+
+// contiguous, type-erased array of the values of one component type
+// rows are only added at the end and removed by moving the last row into the hole
+class Column
+{
+		const ColumnTypeInfo* mTypeInfo;
+		std::byte*			  mData;
+		size_t				  mSize;
+		size_t				  mCapacity;
+
+		void Reserve(size_t capacity);
+
+	public:
+		explicit Column(const ColumnTypeInfo& type_info);
+		~Column();
+
+		Column(Column&& other) noexcept;
+		Column& operator=(Column&& other) = delete;
+		Column(const Column&)			  = delete;
+		Column& operator=(const Column&)  = delete;
+
+		// constructs a new last row, default constructed or moved from the given value
+		void* PushBackDefault();
+		void* PushBackMoved(void* value);
+
+		// moves the last row into the removed one
+		void SwapAndPop(size_t row);
+
+		void Clear();
+
+		void*		operator[](size_t row);
+		const void* operator[](size_t row) const;
+
+		void*				  GetData();
+		size_t				  GetSize() const;
+		const ColumnTypeInfo& GetTypeInfo() const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,32 @@
+#ifndef COLUMNTYPE_HPP
+#define COLUMNTYPE_HPP
+
+#include <Utils/TypeID.hpp>
+#include <cstddef>
+
+class Column;
+
+// ids are only meaningful within the Column family, see TypeID<Column>
+using ColumnTypeID = uint32_t;
+
+// what a type-erased column needs to know about the values it stores
+struct ColumnTypeInfo
+{
+		ColumnTypeID id;
+		size_t		 size;
+		size_t		 alignment;
+
+		void (*default_construct)(void* destination);
+		void (*move_construct)(void* destination, void* source);
+		void (*destroy)(void* value);
+};
+
+template <typename T>
+const ColumnTypeInfo& GetColumnTypeInfo();
+
+template <typename T>
+ColumnTypeID GetColumnTypeID();
+
+#include "ColumnType.inl"
+
+#endif
\ No newline at end of file
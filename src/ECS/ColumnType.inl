@@ -0,0 +1,45 @@
+#include "ColumnType.hpp"
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename T>
+void DefaultConstructColumnValue(void* destination)
+{
+	new (destination) T();
+}
+
+template <typename T>
+void MoveConstructColumnValue(void* destination, void* source)
+{
+	new (destination) T(std::move(*static_cast<T*>(source)));
+}
+
+template <typename T>
+void DestroyColumnValue(void* value)
+{
+	static_cast<T*>(value)->~T();
+}
+
+template <typename T>
+const ColumnTypeInfo& GetColumnTypeInfo()
+{
+	static_assert(std::is_move_constructible_v<T>, "ECS components are moved around when entities change archetype");
+
+	static const ColumnTypeInfo info {
+		GetColumnTypeID<T>(),
+		sizeof(T),
+		alignof(T),
+		&DefaultConstructColumnValue<T>,
+		&MoveConstructColumnValue<T>,
+		&DestroyColumnValue<T>,
+	};
+
+	return info;
+}
+
+template <typename T>
+ColumnTypeID GetColumnTypeID()
+{
+	return TypeID<Column>::Get<std::remove_cvref_t<T>>();
+}
\ No newline at end of file
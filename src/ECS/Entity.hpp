@@ -0,0 +1,20 @@
+#ifndef ENTITY_HPP
+#define ENTITY_HPP
+
+#include <cstdint>
+#include <limits>
+
+// identifies an entity of the World, stale once the entity is destroyed (the generation no longer matches)
+struct Entity
+{
+		static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+		uint32_t index		= INVALID_INDEX;
+		uint32_t generation = 0;
+
+		bool IsNull() const { return index == INVALID_INDEX; }
+
+		bool operator==(const Entity& other) const = default;
+};
+
+#endif
\ No newline at end of file
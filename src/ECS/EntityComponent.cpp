@@ -0,0 +1,30 @@
+#include "EntityComponent.hpp"
+#include <GameObject/GameObject.hpp>
+
+EntityComponent::EntityComponent()
+	: mEntity {}
+{
+}
+
+void EntityComponent::AddToSystem()
+{
+	mEntity = World::GetInstance().CreateEntity(GameObjectLink { GetOwner()->GetHandle() });
+}
+
+void EntityComponent::RemoveFromSystem()
+{
+	World::GetInstance().DestroyEntity(mEntity);
+	mEntity = Entity {};
+}
+
+Entity EntityComponent::GetEntity() const
+{
+	return mEntity;
+}
+
+#include <imgui.h>
+
+void EntityComponent::Edit()
+{
+	ImGui::Text("Entity %u (generation %u)", mEntity.index, mEntity.generation);
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef ENTITYCOMPONENT_HPP
+#define ENTITYCOMPONENT_HPP
+
+#include <Components/Component.hpp>
+#include "Entity.hpp"
+#include "World.hpp"
+
+// stored on every entity created by an EntityComponent, so that ECS systems can reach the GameObject
+struct GameObjectLink
+{
+		GameObjectHandle object;
+};
+
+// bridges a GameObject and an entity of the World:
+// the entity lives as long as the component is part of its owner
+class EntityComponent : public Component
+{
+		Entity mEntity;
+
+		virtual void AddToSystem() override;
+		virtual void RemoveFromSystem() override;
+
+	public:
+		EntityComponent();
+
+		Entity GetEntity() const;
+
+		template <typename T>
+		T* AddEntityComponent(T component = T {});
+
+		template <typename T>
+		T* GetEntityComponent() const;
+
+		template <typename T>
+		void RemoveEntityComponent();
+
+		virtual void Edit() override;
+};
+
+template <typename T>
+T* EntityComponent::AddEntityComponent(T component)
+{
+	return World::GetInstance().AddComponent<T>(mEntity, std::move(component));
+}
+
+template <typename T>
+T* EntityComponent::GetEntityComponent() const
+{
+	return World::GetInstance().GetComponent<T>(mEntity);
+}
+
+template <typename T>
+void EntityComponent::RemoveEntityComponent()
+{
+	World::GetInstance().RemoveComponent<T>(mEntity);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef QUERY_HPP
+#define QUERY_HPP
+
+#include "Archetype.hpp"
+#include <vector>
+
+class World;
+
+// every archetype that has all of Ts, iterated column by column
+// archetypes are only ever added, so the matches are updated incrementally
+template <typename... Ts>
+class Query
+{
+		World*					  mWorld;
+		std::vector<ColumnTypeID> mTypeIDs;
+		std::vector<Archetype*>	  mMatches;
+		size_t					  mCheckedArchetypes;
+		uint32_t				  mResetCount;
+
+		void Refresh();
+
+	public:
+		explicit Query(World& world);
+
+		// function(Ts&...) or function(Entity, Ts&...) for every matching entity
+		template <typename Function>
+		void Each(Function&& function);
+
+		// function(size_t count, const Entity* entities, Ts*... columns) for every matching archetype,
+		// for code that wants to process whole arrays at once
+		template <typename Function>
+		void EachArchetype(Function&& function);
+
+		size_t GetEntityCount();
+};
+
+#include "Query.inl"
+
+#endif
\ No newline at end of file
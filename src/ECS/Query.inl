@@ -0,0 +1,87 @@
+#include "Query.hpp"
+#include "World.hpp"
+#include <algorithm>
+#include <type_traits>
+
+template <typename... Ts>
+Query<Ts...>::Query(World& world)
+	: mWorld { &world }, mTypeIDs { GetColumnTypeID<Ts>()... }, mCheckedArchetypes { 0 }, mResetCount { world.mResetCount }
+{
+	std::sort(mTypeIDs.begin(), mTypeIDs.end());
+}
+
+template <typename... Ts>
+void Query<Ts...>::Refresh()
+{
+	const std::vector<std::unique_ptr<Archetype>>& archetypes = mWorld->mArchetypes;
+
+	// the world was shut down, start over
+	if (mResetCount != mWorld->mResetCount)
+	{
+		mMatches.clear();
+		mCheckedArchetypes = 0;
+		mResetCount		   = mWorld->mResetCount;
+	}
+
+	for (; mCheckedArchetypes < archetypes.size(); mCheckedArchetypes++)
+	{
+		Archetype* archetype = archetypes[mCheckedArchetypes].get();
+		if (archetype->Contains(mTypeIDs))
+		{
+			mMatches.push_back(archetype);
+		}
+	}
+}
+
+template <typename... Ts>
+template <typename Function>
+void Query<Ts...>::Each(Function&& function)
+{
+	EachArchetype([&function](size_t count, const Entity* entities, Ts*... columns) {
+		for (size_t row = 0; row < count; row++)
+		{
+			if constexpr (std::is_invocable_v<Function&, Entity, Ts&...>)
+			{
+				function(entities[row], columns[row]...);
+			}
+			else
+			{
+				function(columns[row]...);
+			}
+		}
+	});
+}
+
+template <typename... Ts>
+template <typename Function>
+void Query<Ts...>::EachArchetype(Function&& function)
+{
+	Refresh();
+
+	for (Archetype* archetype : mMatches)
+	{
+		if (archetype->GetSize() == 0)
+		{
+			continue;
+		}
+
+		function(
+			archetype->GetSize(),
+			archetype->GetEntities().data(),
+			static_cast<Ts*>(archetype->GetColumn(archetype->FindColumn(GetColumnTypeID<Ts>())).GetData())...);
+	}
+}
+
+template <typename... Ts>
+size_t Query<Ts...>::GetEntityCount()
+{
+	Refresh();
+
+	size_t count = 0;
+	for (Archetype* archetype : mMatches)
+	{
+		count += archetype->GetSize();
+	}
+
+	return count;
+}
\ No newline at end of file
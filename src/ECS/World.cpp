@@ -0,0 +1,234 @@
+#include "World.hpp"
+#include <Profiling/Profiler.hpp>
+#include <algorithm>
+
+void World::Update(float dt)
+{
+	PROFILE_ZONE("World");
+
+	for (std::function<void(World&, float)>& system : mSystems)
+	{
+		system(*this, dt);
+	}
+}
+
+void World::Shutdown()
+{
+	mSystems.clear();
+	mRecords.clear();
+	mFreeIndices.clear();
+	mArchetypesBySignature.clear();
+	mArchetypes.clear();
+	mEntityCount = 0;
+	mResetCount++;
+}
+
+void World::AddSystem(std::function<void(World&, float)> system)
+{
+	mSystems.push_back(std::move(system));
+}
+
+Archetype* World::GetArchetype(std::vector<const ColumnTypeInfo*> types)
+{
+	std::sort(types.begin(), types.end(), [](const ColumnTypeInfo* a, const ColumnTypeInfo* b) {
+		return a->id < b->id;
+	});
+
+	std::vector<ColumnTypeID> signature;
+	signature.reserve(types.size());
+	for (const ColumnTypeInfo* type_info : types)
+	{
+		signature.push_back(type_info->id);
+	}
+
+	std::map<std::vector<ColumnTypeID>, Archetype*>::const_iterator it = mArchetypesBySignature.find(signature);
+	if (it != mArchetypesBySignature.end())
+	{
+		return it->second;
+	}
+
+	mArchetypes.push_back(std::make_unique<Archetype>(types));
+	Archetype* archetype = mArchetypes.back().get();
+
+	mArchetypesBySignature.emplace(std::move(signature), archetype);
+
+	return archetype;
+}
+
+Archetype* World::GetAddTransition(Archetype* source, const ColumnTypeInfo& type_info)
+{
+	std::unordered_map<ColumnTypeID, Archetype*>::const_iterator it = source->mAddTransitions.find(type_info.id);
+	if (it != source->mAddTransitions.end())
+	{
+		return it->second;
+	}
+
+	std::vector<const ColumnTypeInfo*> types;
+	for (Column& column : source->mColumns)
+	{
+		types.push_back(&column.GetTypeInfo());
+	}
+	types.push_back(&type_info);
+
+	Archetype* target						 = GetArchetype(types);
+	source->mAddTransitions[type_info.id]	 = target;
+	target->mRemoveTransitions[type_info.id] = source;
+
+	return target;
+}
+
+Archetype* World::GetRemoveTransition(Archetype* source, ColumnTypeID type_id)
+{
+	std::unordered_map<ColumnTypeID, Archetype*>::const_iterator it = source->mRemoveTransitions.find(type_id);
+	if (it != source->mRemoveTransitions.end())
+	{
+		return it->second;
+	}
+
+	std::vector<const ColumnTypeInfo*> types;
+	for (Column& column : source->mColumns)
+	{
+		if (column.GetTypeInfo().id != type_id)
+		{
+			types.push_back(&column.GetTypeInfo());
+		}
+	}
+
+	Archetype* target					= GetArchetype(types);
+	source->mRemoveTransitions[type_id] = target;
+	target->mAddTransitions[type_id]	= source;
+
+	return target;
+}
+
+Entity World::AllocateEntity(Archetype* archetype)
+{
+	uint32_t index;
+
+	if (!mFreeIndices.empty())
+	{
+		index = mFreeIndices.back();
+		mFreeIndices.pop_back();
+	}
+	else
+	{
+		index = static_cast<uint32_t>(mRecords.size());
+		mRecords.push_back(EntityRecord { nullptr, 0, 0 });
+	}
+
+	EntityRecord& record = mRecords[index];
+	record.archetype	 = archetype;
+	record.row			 = static_cast<uint32_t>(archetype->mEntities.size());
+
+	Entity entity { index, record.generation };
+	archetype->mEntities.push_back(entity);
+	mEntityCount++;
+
+	return entity;
+}
+
+void World::RemoveFromArchetype(const EntityRecord& record)
+{
+	Entity moved = record.archetype->RemoveRow(record.row);
+
+	// the last entity of the archetype now lives in the freed row
+	if (!moved.IsNull())
+	{
+		mRecords[moved.index].row = record.row;
+	}
+}
+
+void World::MoveEntity(Entity entity, Archetype* target)
+{
+	EntityRecord& record = mRecords[entity.index];
+	Archetype*	  source = record.archetype;
+
+	for (size_t i = 0; i < target->mColumns.size(); i++)
+	{
+		int source_column = source->FindColumn(target->mSignature[i]);
+		if (source_column != Archetype::INVALID_COLUMN)
+		{
+			target->mColumns[i].PushBackMoved(source->mColumns[source_column][record.row]);
+		}
+	}
+
+	uint32_t target_row = static_cast<uint32_t>(target->mEntities.size());
+	target->mEntities.push_back(entity);
+
+	// the moved-from values are destroyed with the rest of the row
+	RemoveFromArchetype(record);
+
+	record.archetype = target;
+	record.row		 = target_row;
+}
+
+const World::EntityRecord* World::FindRecord(Entity entity) const
+{
+	if (entity.index >= mRecords.size())
+	{
+		return nullptr;
+	}
+
+	const EntityRecord& record = mRecords[entity.index];
+	if (record.generation != entity.generation || record.archetype == nullptr)
+	{
+		return nullptr;
+	}
+
+	return &record;
+}
+
+void* World::FindComponent(Entity entity, ColumnTypeID type_id) const
+{
+	const EntityRecord* record = FindRecord(entity);
+	if (record == nullptr)
+	{
+		return nullptr;
+	}
+
+	int column = record->archetype->FindColumn(type_id);
+	if (column == Archetype::INVALID_COLUMN)
+	{
+		return nullptr;
+	}
+
+	return record->archetype->GetColumn(column)[record->row];
+}
+
+Entity World::CreateEntity()
+{
+	return AllocateEntity(GetArchetype({}));
+}
+
+void World::DestroyEntity(Entity entity)
+{
+	if (FindRecord(entity) == nullptr)
+	{
+		return;
+	}
+
+	EntityRecord& record = mRecords[entity.index];
+	RemoveFromArchetype(record);
+
+	// stale handles no longer match
+	record.archetype = nullptr;
+	record.generation++;
+
+	mFreeIndices.push_back(entity.index);
+	mEntityCount--;
+}
+
+bool World::IsAlive(Entity entity) const
+{
+	return FindRecord(entity) != nullptr;
+}
+
+size_t World::GetEntityCount() const
+{
+	return mEntityCount;
+}
+
+size_t World::GetArchetypeCount() const
+{
+	return mArchetypes.size();
+}
\ No newline at end of file
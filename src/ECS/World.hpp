@@ -0,0 +1,101 @@
+#ifndef WORLD_HPP
+#define WORLD_HPP
+
+#include <Utils/Singleton.hpp>
+#include "Archetype.hpp"
+#include "Entity.hpp"
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+template <typename... Ts>
+class Query;
+
+// archetype based storage for lightweight entities, meant for large amounts of simple objects
+// (particles, projectiles...) that do not need a full GameObject
+// components are plain movable structs, systems iterate them through typed queries
+// structural changes (creating, destroying, adding or removing components) must not happen while iterating
+class World : public Singleton<World>
+{
+		template <typename... Ts>
+		friend class Query;
+
+		struct EntityRecord
+		{
+				Archetype* archetype;
+				uint32_t   row;
+				uint32_t   generation;
+		};
+
+		// archetypes are never destroyed before Shutdown(), queries rely on that
+		std::vector<std::unique_ptr<Archetype>>			  mArchetypes;
+		std::map<std::vector<ColumnTypeID>, Archetype*> mArchetypesBySignature;
+
+		std::vector<EntityRecord> mRecords;
+		std::vector<uint32_t>	  mFreeIndices;
+		size_t					  mEntityCount = 0;
+
+		// bumped by Shutdown(), queries created before it start over
+		uint32_t mResetCount = 0;
+
+		std::vector<std::function<void(World&, float)>> mSystems;
+
+		Archetype* GetArchetype(std::vector<const ColumnTypeInfo*> types);
+		Archetype* GetAddTransition(Archetype* source, const ColumnTypeInfo& type_info);
+		Archetype* GetRemoveTransition(Archetype* source, ColumnTypeID type_id);
+
+		Entity AllocateEntity(Archetype* archetype);
+		void   RemoveFromArchetype(const EntityRecord& record);
+
+		// moves the shared columns of the entity into the target archetype,
+		// columns only present in the target are left for the caller to push
+		void MoveEntity(Entity entity, Archetype* target);
+
+		const EntityRecord* FindRecord(Entity entity) const;
+		void*				FindComponent(Entity entity, ColumnTypeID type_id) const;
+
+	public:
+		// runs one simulation step of dt seconds
+		void Update(float dt);
+		void Shutdown();
+
+		// system(world, dt), run in registration order by Update(dt)
+		void AddSystem(std::function<void(World&, float)> system);
+
+		Entity CreateEntity();
+
+		template <typename... Ts>
+		Entity CreateEntity(Ts... components);
+
+		void DestroyEntity(Entity entity);
+		bool IsAlive(Entity entity) const;
+
+		template <typename T>
+		T* AddComponent(Entity entity, T component = T {});
+
+		template <typename T>
+		void RemoveComponent(Entity entity);
+
+		template <typename T>
+		T* GetComponent(Entity entity) const;
+
+		template <typename T>
+		bool HasComponent(Entity entity) const;
+
+		// the query can be kept, it only looks at the archetypes created since its last use
+		template <typename... Ts>
+		Query<Ts...> CreateQuery();
+
+		// function(Ts&...) or function(Entity, Ts&...) for every entity that has all the types
+		template <typename... Ts, typename Function>
+		void Each(Function&& function);
+
+		size_t GetEntityCount() const;
+		size_t GetArchetypeCount() const;
+};
+
+#include "Query.hpp"
+#include "World.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include "World.hpp"
+
+template <typename... Ts>
+Entity World::CreateEntity(Ts... components)
+{
+	Archetype* archetype = GetArchetype({ &GetColumnTypeInfo<Ts>()... });
+	Entity	   entity	 = AllocateEntity(archetype);
+
+	(archetype->GetColumn(archetype->FindColumn(GetColumnTypeID<Ts>())).PushBackMoved(&components), ...);
+
+	return entity;
+}
+
+template <typename T>
+T* World::AddComponent(Entity entity, T component)
+{
+	const EntityRecord* record = FindRecord(entity);
+	if (record == nullptr)
+	{
+		return nullptr;
+	}
+
+	// already there, just overwrite it
+	if (T* existing = GetComponent<T>(entity))
+	{
+		*existing = std::move(component);
+		return existing;
+	}
+
+	Archetype* target = GetAddTransition(record->archetype, GetColumnTypeInfo<T>());
+	MoveEntity(entity, target);
+
+	Column& column = target->GetColumn(target->FindColumn(GetColumnTypeID<T>()));
+	return static_cast<T*>(column.PushBackMoved(&component));
+}
+
+template <typename T>
+void World::RemoveComponent(Entity entity)
+{
+	const EntityRecord* record = FindRecord(entity);
+	if (record == nullptr || record->archetype->FindColumn(GetColumnTypeID<T>()) == Archetype::INVALID_COLUMN)
+	{
+		return;
+	}
+
+	MoveEntity(entity, GetRemoveTransition(record->archetype, GetColumnTypeID<T>()));
+}
+
+template <typename T>
+T* World::GetComponent(Entity entity) const
+{
+	return static_cast<T*>(FindComponent(entity, GetColumnTypeID<T>()));
+}
+
+template <typename T>
+bool World::HasComponent(Entity entity) const
+{
+	return GetComponent<T>(entity) != nullptr;
+}
+
+template <typename... Ts>
+Query<Ts...> World::CreateQuery()
+{
+	return Query<Ts...> { *this };
+}
+
+template <typename... Ts, typename Function>
+void World::Each(Function&& function)
+{
+	CreateQuery<Ts...>().Each(std::forward<Function>(function));
+}
\ No newline at end of file
@@ -1,11 +1,36 @@
 #include "GameObject.hpp"
 #include "GameObjectManager.hpp"
 #include <Components/Component.hpp>
+#include <Components/LogicSystem.hpp>
 #include <Transformation/TransformationComponent.hpp>
+#include <algorithm>
+
+namespace
+{
+	bool CompareTypeID(const std::pair<ComponentTypeID, Component*>& entry, ComponentTypeID type_id)
+	{
+		return entry.first < type_id;
+	}
+
+	void FreeComponent(Component* component)
+	{
+		// components created outside AddComponent<T>() come from the regular heap
+		if (const ComponentTypeInfo* type_info = component->GetTypeInfo())
+		{
+			type_info->destroy(component);
+		}
+		else
+		{
+			delete component;
+		}
+	}
+} // namespace
 
 GameObject::GameObject(const std::string& name)
-	: mName { name }, mParent { nullptr }
+	: mName { nullptr }, mNameIndex { GameObjectManager::INVALID_INDEX }, mParent {},
+	  mRootIndex { GameObjectManager::INVALID_INDEX }, mMarkedAsDead { false }
 {
+	GameObjectManager::GetInstance().RegisterGameObject(this, name);
 }
 
 GameObject* GameObject::FindObjectByName(const std::string& name)
@@ -20,12 +45,22 @@ std::vector<GameObject*> GameObject::FindAllObjectsWithName(const std::string& n
 
 void GameObject::SetName(const std::string& name)
 {
-	mName = name;
+	GameObjectManager::GetInstance().RenameGameObject(this, name);
 }
 
 std::string GameObject::GetName() const
 {
-	return mName;
+	return *mName;
+}
+
+GameObjectHandle GameObject::GetHandle() const
+{
+	return mHandle;
+}
+
+bool GameObject::IsMarkedAsDead() const
+{
+	return mMarkedAsDead;
 }
 
 std::vector<Component*> GameObject::GetAllComponents() const
@@ -45,8 +80,9 @@ Component* GameObject::AddComponent(Component* component)
 		return nullptr;
 	}
 
-	component->mOwner = this;
+	component->mOwner = mHandle;
 	mComponents.push_back(component);
+	RebuildComponentIndex();
 
 	component->Create();
 
@@ -63,11 +99,10 @@ void GameObject::RemoveComponent(Component* component)
 		}
 
 		component->Shutdown();
-
-		// memory manager
-		delete component;
+		FreeComponent(component);
 
 		mComponents.erase(it);
+		RebuildComponentIndex();
 
 		return;
 	}
@@ -83,13 +118,93 @@ void GameObject::InternalDestroy()
 	for (Component* component : mComponents)
 	{
 		component->Shutdown();
-
-		// memory manager
-		delete component;
+		FreeComponent(component);
 	}
 
 	mChildren.clear();
 	mComponents.clear();
+	mComponentIndex.clear();
+	mComponentLookupCache.clear();
+}
+
+void GameObject::RebuildComponentIndex()
+{
+	mComponentIndex.clear();
+	mComponentLookupCache.clear();
+
+	for (Component* component : mComponents)
+	{
+		// components added without type information are found through the slow path
+		if (component->mTypeInfo == nullptr)
+		{
+			continue;
+		}
+
+		std::vector<std::pair<ComponentTypeID, Component*>>::iterator it = std::lower_bound(
+			mComponentIndex.begin(),
+			mComponentIndex.end(),
+			component->mTypeInfo->id,
+			CompareTypeID);
+
+		// keep the first component of each type, like the linear search did
+		if (it == mComponentIndex.end() || it->first != component->mTypeInfo->id)
+		{
+			mComponentIndex.insert(it, std::pair<ComponentTypeID, Component*> { component->mTypeInfo->id, component });
+		}
+	}
+}
+
+Component* GameObject::FindExactComponent(ComponentTypeID type_id) const
+{
+	std::vector<std::pair<ComponentTypeID, Component*>>::const_iterator it = std::lower_bound(
+		mComponentIndex.begin(),
+		mComponentIndex.end(),
+		type_id,
+		CompareTypeID);
+
+	if (it != mComponentIndex.end() && it->first == type_id)
+	{
+		return it->second;
+	}
+
+	return nullptr;
+}
+
+bool GameObject::FindCachedComponent(ComponentTypeID type_id, Component*& component) const
+{
+	std::vector<std::pair<ComponentTypeID, Component*>>::const_iterator it = std::lower_bound(
+		mComponentLookupCache.begin(),
+		mComponentLookupCache.end(),
+		type_id,
+		CompareTypeID);
+
+	if (it != mComponentLookupCache.end() && it->first == type_id)
+	{
+		component = it->second;
+		return true;
+	}
+
+	return false;
+}
+
+void GameObject::CacheComponent(ComponentTypeID type_id, Component* component) const
+{
+	// several logic buckets may be looking into the same object, the cache stays read-only meanwhile
+	if (LogicSystem::GetInstance().IsInParallelPhase())
+	{
+		return;
+	}
+
+	std::vector<std::pair<ComponentTypeID, Component*>>::iterator it = std::lower_bound(
+		mComponentLookupCache.begin(),
+		mComponentLookupCache.end(),
+		type_id,
+		CompareTypeID);
+
+	if (it == mComponentLookupCache.end() || it->first != type_id)
+	{
+		mComponentLookupCache.insert(it, std::pair<ComponentTypeID, Component*> { type_id, component });
+	}
 }
 
 void GameObject::Initialize()
@@ -100,7 +215,7 @@ void GameObject::Initialize()
 	for (GameObject* child : mChildren)
 		child->Initialize();
 
-	if (mParent == nullptr)
+	if (GetParent() == nullptr)
 		GameObjectManager::GetInstance().AddGameObject(this);
 }
 
@@ -135,42 +250,44 @@ void GameObject::DetachChild(GameObject* child)
 
 GameObject* GameObject::GetParent() const
 {
-	return mParent;
+	return GameObjectManager::GetInstance().Resolve(mParent);
 }
 
 void GameObject::SetParent(GameObject* parent)
 {
+	GameObject* previous_parent = GetParent();
+
 	// detach from current parent
-	if (mParent != nullptr)
+	if (previous_parent != nullptr)
 	{
-		mParent->DetachChild(this);
+		previous_parent->DetachChild(this);
 	}
 
 	// if previously an orfan and now has a parent
-	if (mParent == nullptr && parent != nullptr)
+	if (previous_parent == nullptr && parent != nullptr)
 	{
 		GameObjectManager::GetInstance().RemoveRootGameObject(this);
 	}
 
 	// similarly, if the object becomes orfan
-	else if (mParent != nullptr && parent == nullptr)
+	else if (previous_parent != nullptr && parent == nullptr)
 	{
 		GameObjectManager::GetInstance().AddGameObject(this);
 	}
 
-	mParent = parent;
+	mParent = parent != nullptr ? parent->mHandle : GameObjectHandle {};
 
 	// if the object has a transformation
 	// set the parent transformation accordingly
 	if (TransformationComponent* transformation_component = GetComponent<TransformationComponent>())
 	{
-		if (mParent == nullptr)
+		if (parent == nullptr)
 		{
 			transformation_component->SetParent(nullptr);
 		}
 		else
 		{
-			transformation_component->SetParent(mParent->GetComponent<TransformationComponent>());
+			transformation_component->SetParent(parent->GetComponent<TransformationComponent>());
 		}
 	}
 }
@@ -200,7 +317,7 @@ void GameObject::AddChild(GameObject* child)
 
 GameObject* GameObject::NewChild(const std::string& name)
 {
-	GameObject* new_child = new GameObject { name };
+	GameObject* new_child = PoolAllocator<GameObject>::GetInstance().New(name);
 	AddChild(new_child);
 	return new_child;
 }
@@ -208,8 +325,9 @@ GameObject* GameObject::NewChild(const std::string& name)
 void GameObject::RemoveChild(GameObject* child)
 {
 	DetachChild(child);
+
+	// the memory is released by the GameObjectManager once the object is destroyed
 	child->Shutdown();
-	delete child;
 }
 
 const std::vector<GameObject*>& GameObject::GetChildren() const
@@ -242,7 +360,12 @@ void GameObject::Edit()
 		return;
 	}
 
-	ImGui::InputText("Name", &edit_target->mName);
+	// go through SetName so the name index stays up to date
+	std::string name = edit_target->GetName();
+	if (ImGui::InputText("Name", &name))
+	{
+		edit_target->SetName(name);
+	}
 
 	int id = 0;
 	for (Component* component : edit_target->mComponents)
@@ -3,26 +3,62 @@
 
 #include <vector>
 #include <string>
+#include <utility>
+#include <Components/ComponentType.hpp>
+#include <Memory/MemoryTracker.hpp>
+#include <Memory/PoolAllocator.hpp>
+#include <Utils/Handle.hpp>
 
 class Component;
+class GameObject;
 class GameObjectManager;
 
+using GameObjectHandle = Handle<GameObject>;
+
 class GameObject
 {
 		friend class GameObjectManager;
 
-		std::string mName;
+		// the constructor is private, objects are only created through the pool
+		template <typename T, size_t ChunkSize>
+		friend class PoolAllocator;
+
+		// interned by the GameObjectManager, shared by every object with the same name
+		const std::string* mName;
+
+		// position among the objects with the same name
+		int mNameIndex;
+
+		GameObjectHandle mHandle;
 
-		GameObject*				 mParent;
+		GameObjectHandle		 mParent;
 		std::vector<GameObject*> mChildren;
 
+		// position in GameObjectManager::mAllRootObjects, INVALID_INDEX while not a root
+		int mRootIndex;
+
+		// set by GameObjectManager::DestroyGameObject, released at the end of the frame
+		bool mMarkedAsDead;
+
 		std::vector<Component*> mComponents;
 
+		// component type id -> first component of exactly that type, sorted by id
+		std::vector<std::pair<ComponentTypeID, Component*>> mComponentIndex;
+
+		// results of base class queries (null included), cleared whenever the components change
+		// not filled during a parallel logic phase, see LogicSystem
+		mutable std::vector<std::pair<ComponentTypeID, Component*>> mComponentLookupCache;
+
 		GameObject(const std::string& name = "Game Object");
 
 		void InternalDestroy();
 		void DetachChild(GameObject* child);
 
+		void	   RebuildComponentIndex();
+		Component* FindExactComponent(ComponentTypeID type_id) const;
+		bool	   FindCachedComponent(ComponentTypeID type_id, Component*& component) const;
+		void	   CacheComponent(ComponentTypeID type_id, Component* component) const;
+
 		static inline GameObject* edit_target = nullptr;
 
 	public:
@@ -32,6 +68,9 @@ class GameObject
 		void		SetName(const std::string& name);
 		std::string GetName() const;
 
+		GameObjectHandle GetHandle() const;
+		bool			 IsMarkedAsDead() const;
+
 		void Initialize();
 		void Shutdown();
 		void ShutdownEvents();
@@ -71,6 +110,12 @@ class GameObject
 		static void Edit();
 };
 
+template <>
+struct MemoryTagOf<GameObject>
+{
+		static constexpr MemoryTag value = MemoryTag::GameObjects;
+};
+
 #include "GameObject.inl"
 
 #endif
\ No newline at end of file
@@ -1,17 +1,37 @@
 #include "GameObject.hpp"
+#include <Components/Component.hpp>
 
 template <typename T>
 T* GameObject::GetComponent() const
 {
+	ComponentTypeID type_id = TypeID<Component>::Get<T>();
+
+	// fast path: a component of exactly the requested type
+	if (Component* component = FindExactComponent(type_id))
+	{
+		return static_cast<T*>(component);
+	}
+
+	// base class queries are only resolved once
+	Component* cached_component = nullptr;
+	if (FindCachedComponent(type_id, cached_component))
+	{
+		return static_cast<T*>(cached_component);
+	}
+
+	T* found_component = nullptr;
 	for (Component* component : mComponents)
 	{
 		if (T* casted_component = dynamic_cast<T*>(component))
 		{
-			return casted_component;
+			found_component = casted_component;
+			break;
 		}
 	}
 
-	return nullptr;
+	CacheComponent(type_id, found_component);
+
+	return found_component;
 }
 
 template <typename T>
@@ -19,9 +39,16 @@ std::vector<T*> GameObject::GetAllComponents() const
 {
 	std::vector<T*> components;
 
+	const ComponentTypeInfo* type_info = &GetComponentTypeInfo<T>();
+
 	for (Component* component : mComponents)
 	{
-		if (T* casted_component = dynamic_cast<T*>(component))
+		// avoid the cast when the type is an exact match
+		if (component->mTypeInfo == type_info)
+		{
+			components.push_back(static_cast<T*>(component));
+		}
+		else if (T* casted_component = dynamic_cast<T*>(component))
 		{
 			components.push_back(casted_component);
 		}
@@ -33,8 +60,10 @@ std::vector<T*> GameObject::GetAllComponents() const
 template <typename T>
 T* GameObject::AddComponent()
 {
-	// at some point, move this to a memory manager
-	return static_cast<T*>(AddComponent(new T {}));
+	T* component		 = PoolAllocator<T>::GetInstance().New();
+	component->mTypeInfo = &GetComponentTypeInfo<T>();
+
+	return static_cast<T*>(AddComponent(component));
 }
 
 template <typename T>
@@ -1,12 +1,98 @@
 #include "GameObjectManager.hpp"
 #include "GameObject.hpp"
+#include <Memory/PoolAllocator.hpp>
+#include <Profiling/Profiler.hpp>
+#include <algorithm>
 
 void GameObjectManager::Update()
 {
+	PROFILE_ZONE("GameObjectManager");
+
+	if (mObjectsMarkedAsDead.empty())
+	{
+		return;
+	}
+
+	// destroying an object marks its children as dead,
+	// which appends them to the array while it is being traversed
+	for (size_t i = 0; i < mObjectsMarkedAsDead.size(); i++)
+	{
+		mObjectsMarkedAsDead[i]->InternalDestroy();
+	}
+
+	// a parent that is still alive must not keep pointers to released objects,
+	// each of them is compacted once no matter how many children it lost
+	for (GameObject* object : mObjectsMarkedAsDead)
+	{
+		GameObject* parent = Resolve(object->mParent);
+		if (parent != nullptr && !parent->mMarkedAsDead)
+		{
+			mParentsToCompact.push_back(parent);
+		}
+	}
+
+	std::sort(mParentsToCompact.begin(), mParentsToCompact.end());
+	mParentsToCompact.erase(std::unique(mParentsToCompact.begin(), mParentsToCompact.end()), mParentsToCompact.end());
+
+	for (GameObject* parent : mParentsToCompact)
+	{
+		std::erase_if(parent->mChildren, [](GameObject* child) { return child->mMarkedAsDead; });
+	}
+
+	mParentsToCompact.clear();
+
+	// a single pass over the roots, keeping the order of the survivors
+	int root_count = 0;
+	for (GameObject* object : mAllRootObjects)
+	{
+		if (object->mMarkedAsDead)
+		{
+			object->mRootIndex = INVALID_INDEX;
+			continue;
+		}
+
+		mAllRootObjects[root_count] = object;
+		object->mRootIndex			= root_count;
+		root_count++;
+	}
+	mAllRootObjects.resize(root_count);
+
+	// same for the name lists, each one is compacted once no matter how many objects it lost
+	for (GameObject* object : mObjectsMarkedAsDead)
+	{
+		mNamesToCompact.push_back(object->mName);
+	}
+
+	std::sort(mNamesToCompact.begin(), mNamesToCompact.end());
+	mNamesToCompact.erase(std::unique(mNamesToCompact.begin(), mNamesToCompact.end()), mNamesToCompact.end());
+
+	for (const std::string* name : mNamesToCompact)
+	{
+		std::unordered_map<std::string, std::vector<GameObject*>>::iterator it = mObjectsByName.find(*name);
+
+		std::vector<GameObject*>& objects = it->second;
+
+		std::erase_if(objects, [](GameObject* object) { return object->mMarkedAsDead; });
+
+		for (size_t i = 0; i < objects.size(); i++)
+		{
+			objects[i]->mNameIndex = static_cast<int>(i);
+		}
+
+		// nobody points at the interned name anymore
+		if (objects.empty())
+		{
+			mObjectsByName.erase(it);
+		}
+	}
+
+	mNamesToCompact.clear();
+
+	// only release the memory once no destroyed object can be referenced anymore
 	for (GameObject* object : mObjectsMarkedAsDead)
 	{
-		object->InternalDestroy();
-		RemoveRootGameObject(object);
+		UnregisterGameObject(object);
+		PoolAllocator<GameObject>::GetInstance().Delete(object);
 	}
 
 	mObjectsMarkedAsDead.clear();
@@ -14,12 +100,20 @@ void GameObjectManager::Update()
 
 void GameObjectManager::RemoveRootGameObject(GameObject* object)
 {
-	if (object == nullptr)
+	if (object == nullptr || object->mRootIndex == INVALID_INDEX)
 	{
 		return;
 	}
 
-	mAllRootObjects.remove(object);
+	// swap and pop
+	int			index = object->mRootIndex;
+	GameObject* last  = mAllRootObjects.back();
+
+	mAllRootObjects[index] = last;
+	last->mRootIndex	   = index;
+
+	mAllRootObjects.pop_back();
+	object->mRootIndex = INVALID_INDEX;
 }
 
 void GameObjectManager::Shutdown()
@@ -27,16 +121,21 @@ void GameObjectManager::Shutdown()
 	for (GameObject* object : mAllRootObjects)
 		object->ShutdownEvents();
 
+	// children are marked as dead when their parents are destroyed,
+	// so everything ends up being released by the same sweep
 	for (GameObject* object : mAllRootObjects)
 	{
-		object->InternalDestroy();
+		DestroyGameObject(object);
+	}
+
+	Update();
 
-		// memory manager!
-		delete object;
+	for (GameObject* object : mAllRootObjects)
+	{
+		object->mRootIndex = INVALID_INDEX;
 	}
 
 	mAllRootObjects.clear();
-	mObjectsMarkedAsDead.clear();
 }
 
 void GameObjectManager::DestroyGameObject(GameObject* object)
@@ -47,17 +146,19 @@ void GameObjectManager::DestroyGameObject(GameObject* object)
 	}
 
 	// do not add an object twice
-	if (std::find(mObjectsMarkedAsDead.begin(), mObjectsMarkedAsDead.end(), object) == mObjectsMarkedAsDead.end())
+	if (object->mMarkedAsDead)
 	{
-		mObjectsMarkedAsDead.push_back(object);
+		return;
 	}
+
+	object->mMarkedAsDead = true;
+	mObjectsMarkedAsDead.push_back(object);
 }
 
 GameObject* GameObjectManager::NewGameObject(const std::string& name)
 {
-	GameObject* new_object = new GameObject { name };
-	mAllRootObjects.push_back(new_object);
-	return new_object;
+	GameObject* new_object = PoolAllocator<GameObject>::GetInstance().New(name);
+	return AddGameObject(new_object);
 }
 
 GameObject* GameObjectManager::AddGameObject(GameObject* object)
@@ -67,82 +168,108 @@ GameObject* GameObjectManager::AddGameObject(GameObject* object)
 		return nullptr;
 	}
 
-	if (std::find(mAllRootObjects.begin(), mAllRootObjects.end(), object) == mAllRootObjects.end())
+	// already a root
+	if (object->mRootIndex != INVALID_INDEX)
 	{
-		mAllRootObjects.push_back(object);
+		return object;
 	}
 
+	object->mRootIndex = static_cast<int>(mAllRootObjects.size());
+	mAllRootObjects.push_back(object);
+
 	return object;
 }
 
-GameObject* FindObjectByNameRecursive(const std::string& name, GameObject* object)
+GameObject* GameObjectManager::FindObjectByName(const std::string& name) const
 {
-	if (object == nullptr)
+	std::unordered_map<std::string, std::vector<GameObject*>>::const_iterator it = mObjectsByName.find(name);
+	if (it == mObjectsByName.end())
 	{
 		return nullptr;
 	}
 
-	if (object->GetName() == name)
-	{
-		return object;
-	}
+	return it->second.front();
+}
 
-	const std::vector<GameObject*>& children = object->GetChildren();
-	for (GameObject* child : children)
+std::vector<GameObject*> GameObjectManager::FindAllObjectsWithName(const std::string& name) const
+{
+	std::unordered_map<std::string, std::vector<GameObject*>>::const_iterator it = mObjectsByName.find(name);
+	if (it == mObjectsByName.end())
 	{
-		GameObject* found_object = FindObjectByNameRecursive(name, child);
-		if (found_object != nullptr)
-		{
-			return found_object;
-		}
+		return {};
 	}
 
-	return nullptr;
+	return it->second;
 }
 
-GameObject* GameObjectManager::FindObjectByName(const std::string& name) const
+GameObject* GameObjectManager::Resolve(GameObjectHandle handle) const
 {
-	for (GameObject* object : mAllRootObjects)
-	{
-		GameObject* found_object = FindObjectByNameRecursive(name, object);
-		if (found_object != nullptr)
-		{
-			return found_object;
-		}
-	}
+	return mHandles.Resolve(handle);
+}
 
-	return nullptr;
+void GameObjectManager::RegisterGameObject(GameObject* object, const std::string& name)
+{
+	object->mHandle = mHandles.Add(object);
+	AddToNameIndex(object, name);
 }
 
-void FindAllObjectWithNameRecursive(const std::string& name, GameObject* object, std::vector<GameObject*>& all_objects)
+void GameObjectManager::UnregisterGameObject(GameObject* object)
 {
-	if (object == nullptr)
+	// already out of the name index, see Update()
+	object->mName	   = nullptr;
+	object->mNameIndex = INVALID_INDEX;
+
+	mHandles.Remove(object->mHandle);
+	object->mHandle = GameObjectHandle {};
+}
+
+void GameObjectManager::RenameGameObject(GameObject* object, const std::string& name)
+{
+	if (object->mName != nullptr && *object->mName == name)
 	{
 		return;
 	}
 
-	if (object->GetName() == name)
+	RemoveFromNameIndex(object);
+	AddToNameIndex(object, name);
+}
+
+void GameObjectManager::AddToNameIndex(GameObject* object, const std::string& name)
+{
+	// the key is never moved by the map, so it can be shared as the interned name
+	std::unordered_map<std::string, std::vector<GameObject*>>::iterator it = mObjectsByName.try_emplace(name).first;
+
+	object->mName	   = &it->first;
+	object->mNameIndex = static_cast<int>(it->second.size());
+	it->second.push_back(object);
+}
+
+void GameObjectManager::RemoveFromNameIndex(GameObject* object)
+{
+	if (object->mNameIndex == INVALID_INDEX)
 	{
-		all_objects.push_back(object);
+		return;
 	}
 
-	const std::vector<GameObject*>& children = object->GetChildren();
-	for (GameObject* child : children)
+	std::unordered_map<std::string, std::vector<GameObject*>>::iterator it = mObjectsByName.find(*object->mName);
+
+	// erased rather than swapped with the last one, the objects stay in the order they got the name
+	// only for renames, destroyed objects leave their lists in a single pass (see Update())
+	std::vector<GameObject*>& objects = it->second;
+	objects.erase(objects.begin() + object->mNameIndex);
+
+	for (size_t i = object->mNameIndex; i < objects.size(); i++)
 	{
-		FindAllObjectWithNameRecursive(name, child, all_objects);
+		objects[i]->mNameIndex = static_cast<int>(i);
 	}
-}
 
-std::vector<GameObject*> GameObjectManager::FindAllObjectsWithName(const std::string& name) const
-{
-	std::vector<GameObject*> all_objects;
+	object->mNameIndex = INVALID_INDEX;
 
-	for (GameObject* object : mAllRootObjects)
+	// nobody points at the interned name anymore
+	if (objects.empty())
 	{
-		FindAllObjectWithNameRecursive(name, object, all_objects);
+		mObjectsByName.erase(it);
 	}
-
-	return all_objects;
 }
 
 #include <imgui.h>
@@ -2,22 +2,46 @@
 #define GAMEOBJECTMANAGER_HPP
 
 #include <Utils/Singleton.hpp>
+#include <Utils/Handle.hpp>
 #include <string>
-#include <list>
+#include <unordered_map>
 #include <vector>
 
 class GameObject;
 
+using GameObjectHandle = Handle<GameObject>;
+
 class GameObjectManager : public Singleton<GameObjectManager>
 {
 		friend class GameObject;
 
-		std::list<GameObject*> mAllRootObjects;
-		std::list<GameObject*> mObjectsMarkedAsDead;
+		// dense, every root knows its own position (GameObject::mRootIndex)
+		std::vector<GameObject*> mAllRootObjects;
+		std::vector<GameObject*> mObjectsMarkedAsDead;
+
+		// live parents that had children destroyed during the current sweep
+		std::vector<GameObject*> mParentsToCompact;
+
+		// names that had objects destroyed during the current sweep
+		std::vector<const std::string*> mNamesToCompact;
+
+		// every live object, keyed by name; the keys are the interned names objects point to
+		// each list is in the order the objects got the name (created or renamed)
+		std::unordered_map<std::string, std::vector<GameObject*>> mObjectsByName;
+
+		HandleTable<GameObject> mHandles;
 
 		void RemoveRootGameObject(GameObject* object);
 
+		void RegisterGameObject(GameObject* object, const std::string& name);
+		void UnregisterGameObject(GameObject* object);
+		void RenameGameObject(GameObject* object, const std::string& name);
+		void AddToNameIndex(GameObject* object, const std::string& name);
+		void RemoveFromNameIndex(GameObject* object);
+
 	public:
+		static constexpr int INVALID_INDEX = -1;
+
 		void Update();
 		void Shutdown();
 
@@ -25,9 +49,14 @@ class GameObjectManager : public Singleton<GameObjectManager>
 
 		GameObject* NewGameObject(const std::string& name = "Game Object");
 		GameObject* AddGameObject(GameObject* object);
-		GameObject* FindObjectByName(const std::string& name) const;
+
+		// the live object that got the name first (created with it or renamed to it)
+		GameObject*				 FindObjectByName(const std::string& name) const;
 		std::vector<GameObject*> FindAllObjectsWithName(const std::string& name) const;
 
+		// null once the object has been released
+		GameObject* Resolve(GameObjectHandle handle) const;
+
 		void Display();
 };
 
@@ -1,4 +1,5 @@
 #include "InputManager.hpp"
+#include <Profiling/Profiler.hpp>
 #include <cctype>
 
 void InputManager::Initialize()
@@ -56,6 +57,8 @@ void InputManager::DisconnectController()
 
 void InputManager::Update()
 {
+	PROFILE_ZONE("InputManager");
+
 	SDL_PumpEvents();
 
 	// KEYBOARD
@@ -0,0 +1,181 @@
+#include "MemoryTracker.hpp"
+#include <algorithm>
+#include <iostream>
+
+MemoryTracker::TagCounters& MemoryTracker::GetCounters(MemoryTag tag)
+{
+	return mCounters[static_cast<size_t>(tag)];
+}
+
+const char* MemoryTracker::GetTagName(MemoryTag tag)
+{
+	switch (tag)
+	{
+		case MemoryTag::Resources: return "Resources";
+		case MemoryTag::GameObjects: return "GameObjects";
+		case MemoryTag::Components: return "Components";
+		case MemoryTag::Transforms: return "Transforms";
+		case MemoryTag::Models: return "Models";
+		case MemoryTag::Textures: return "Textures";
+		default: return "Unknown";
+	}
+}
+
+void MemoryTracker::CheckBudget(MemoryTag tag, size_t live_bytes)
+{
+	TagCounters& counters = GetCounters(tag);
+
+	size_t budget = counters.budget.load(std::memory_order_relaxed);
+	if (budget != 0 && live_bytes > budget && counters.over_budget.exchange(true, std::memory_order_relaxed) == false)
+	{
+		std::cerr << "Memory budget of " << GetTagName(tag) << " exceeded: " << live_bytes << " bytes live, "
+				  << budget << " allowed." << std::endl;
+	}
+}
+
+void MemoryTracker::Allocate(MemoryTag tag, size_t bytes)
+{
+	TagCounters& counters = GetCounters(tag);
+
+	size_t live_bytes = counters.live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+	counters.live_allocations.fetch_add(1, std::memory_order_relaxed);
+	counters.total_allocations.fetch_add(1, std::memory_order_relaxed);
+
+	size_t peak_bytes = counters.peak_bytes.load(std::memory_order_relaxed);
+	while (live_bytes > peak_bytes
+		   && counters.peak_bytes.compare_exchange_weak(peak_bytes, live_bytes, std::memory_order_relaxed) == false)
+	{
+	}
+
+	CheckBudget(tag, live_bytes);
+}
+
+void MemoryTracker::Free(MemoryTag tag, size_t bytes)
+{
+	TagCounters& counters = GetCounters(tag);
+
+	size_t live_bytes = counters.live_bytes.fetch_sub(bytes, std::memory_order_relaxed) - bytes;
+	counters.live_allocations.fetch_sub(1, std::memory_order_relaxed);
+
+	// warn again the next time it goes over
+	if (live_bytes <= counters.budget.load(std::memory_order_relaxed))
+	{
+		counters.over_budget.store(false, std::memory_order_relaxed);
+	}
+}
+
+MemoryStats MemoryTracker::GetStats(MemoryTag tag) const
+{
+	const TagCounters& counters = mCounters[static_cast<size_t>(tag)];
+
+	MemoryStats stats;
+	stats.live_bytes		= counters.live_bytes.load(std::memory_order_relaxed);
+	stats.peak_bytes		= counters.peak_bytes.load(std::memory_order_relaxed);
+	stats.live_allocations	= counters.live_allocations.load(std::memory_order_relaxed);
+	stats.total_allocations = counters.total_allocations.load(std::memory_order_relaxed);
+	stats.budget			= counters.budget.load(std::memory_order_relaxed);
+
+	return stats;
+}
+
+size_t MemoryTracker::GetTotalLiveBytes() const
+{
+	size_t live_bytes = 0;
+	for (const TagCounters& counters : mCounters)
+	{
+		live_bytes += counters.live_bytes.load(std::memory_order_relaxed);
+	}
+
+	return live_bytes;
+}
+
+void MemoryTracker::SetBudget(MemoryTag tag, size_t bytes)
+{
+	TagCounters& counters = GetCounters(tag);
+
+	counters.budget.store(bytes, std::memory_order_relaxed);
+	counters.over_budget.store(false, std::memory_order_relaxed);
+
+	CheckBudget(tag, counters.live_bytes.load(std::memory_order_relaxed));
+}
+
+bool MemoryTracker::IsOverBudget(MemoryTag tag) const
+{
+	MemoryStats stats = GetStats(tag);
+	return stats.budget != 0 && stats.live_bytes > stats.budget;
+}
+
+void MemoryTracker::ResetPeaks()
+{
+	for (TagCounters& counters : mCounters)
+	{
+		counters.peak_bytes.store(counters.live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+}
+
+#include <imgui.h>
+
+void MemoryTracker::Display()
+{
+	static constexpr float MEGABYTE = 1024.0f * 1024.0f;
+
+	ImGui::Text("Total: %.2f MB", GetTotalLiveBytes() / MEGABYTE);
+
+	if (ImGui::Button("Reset peaks"))
+	{
+		ResetPeaks();
+	}
+
+	if (ImGui::BeginTable("Memory", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg) == false)
+	{
+		return;
+	}
+
+	ImGui::TableSetupColumn("Tag");
+	ImGui::TableSetupColumn("Live (MB)");
+	ImGui::TableSetupColumn("Peak (MB)");
+	ImGui::TableSetupColumn("Allocations");
+	ImGui::TableSetupColumn("Budget (MB)");
+	ImGui::TableHeadersRow();
+
+	for (size_t i = 0; i < TAG_COUNT; i++)
+	{
+		MemoryTag	tag	  = static_cast<MemoryTag>(i);
+		MemoryStats stats = GetStats(tag);
+
+		ImGui::PushID(static_cast<int>(i));
+		ImGui::TableNextRow();
+
+		ImGui::TableNextColumn();
+		if (IsOverBudget(tag))
+		{
+			ImGui::TextColored(ImVec4 { 1.0f, 0.3f, 0.3f, 1.0f }, "%s", GetTagName(tag));
+		}
+		else
+		{
+			ImGui::TextUnformatted(GetTagName(tag));
+		}
+
+		ImGui::TableNextColumn();
+		ImGui::Text("%.2f", stats.live_bytes / MEGABYTE);
+
+		ImGui::TableNextColumn();
+		ImGui::Text("%.2f", stats.peak_bytes / MEGABYTE);
+
+		// live ones, and every one made so far
+		ImGui::TableNextColumn();
+		ImGui::Text("%zu / %zu", stats.live_allocations, stats.total_allocations);
+
+		ImGui::TableNextColumn();
+		float budget = stats.budget / MEGABYTE;
+		ImGui::SetNextItemWidth(-1.0f);
+		if (ImGui::DragFloat("##Budget", &budget, 0.25f, 0.0f, 65536.0f, budget > 0.0f ? "%.2f" : "none"))
+		{
+			SetBudget(tag, static_cast<size_t>(std::max(budget, 0.0f) * MEGABYTE));
+		}
+
+		ImGui::PopID();
+	}
+
+	ImGui::EndTable();
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef MEMORYTRACKER_HPP
+#define MEMORYTRACKER_HPP
+
+#include <Utils/Singleton.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// subsystems the memory is accounted to
+enum class MemoryTag : uint8_t
+{
+	Resources,
+	GameObjects,
+	Components,
+	Transforms,
+	Models,
+	Textures,
+	Count
+};
+
+// tag used by PoolAllocator<T>, specialized next to each pooled type
+template <typename T>
+struct MemoryTagOf;
+
+struct MemoryStats
+{
+		size_t live_bytes;
+		size_t peak_bytes;
+		size_t live_allocations;
+		size_t total_allocations;
+
+		// 0 when there is none
+		size_t budget;
+};
+
+// counts the memory each subsystem holds, reported by the allocators and by the resources themselves
+// (GPU memory included, for models and textures), safe to call from any thread
+// going over a budget prints a warning once, until the tag is back under it
+class MemoryTracker : public Singleton<MemoryTracker>
+{
+		struct TagCounters
+		{
+				std::atomic<size_t> live_bytes { 0 };
+				std::atomic<size_t> peak_bytes { 0 };
+				std::atomic<size_t> live_allocations { 0 };
+				std::atomic<size_t> total_allocations { 0 };
+				std::atomic<size_t> budget { 0 };
+				std::atomic<bool>	over_budget { false };
+		};
+
+		std::array<TagCounters, static_cast<size_t>(MemoryTag::Count)> mCounters;
+
+		TagCounters& GetCounters(MemoryTag tag);
+		void		 CheckBudget(MemoryTag tag, size_t live_bytes);
+
+	public:
+		static constexpr size_t TAG_COUNT = static_cast<size_t>(MemoryTag::Count);
+
+		static const char* GetTagName(MemoryTag tag);
+
+		void Allocate(MemoryTag tag, size_t bytes);
+		void Free(MemoryTag tag, size_t bytes);
+
+		MemoryStats GetStats(MemoryTag tag) const;
+		size_t		GetTotalLiveBytes() const;
+
+		// bytes = 0 removes the budget
+		void SetBudget(MemoryTag tag, size_t bytes);
+		bool IsOverBudget(MemoryTag tag) const;
+
+		void ResetPeaks();
+
+		void Display();
+};
+
+#endif
\ No newline at end of file
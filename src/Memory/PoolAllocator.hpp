@@ -0,0 +1,44 @@
+#ifndef POOLALLOCATOR_HPP
+#define POOLALLOCATOR_HPP
+
+#include <Utils/Singleton.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// typed pool that carves objects out of fixed-size chunks
+// chunks are never moved nor released while the pool is alive, so addresses are stable,
+// and freed slots are reused (last freed, first reused) through an intrusive free list
+// not thread safe
+// the chunks are reported to the MemoryTracker under MemoryTagOf<T>
+template <typename T, size_t ChunkSize = 256>
+class PoolAllocator : public Singleton<PoolAllocator<T, ChunkSize>>
+{
+		union Slot
+		{
+				Slot* next;
+				alignas(T) unsigned char storage[sizeof(T)];
+		};
+
+		std::vector<std::unique_ptr<Slot[]>> mChunks;
+		Slot*								 mFreeList	= nullptr;
+		size_t								 mLiveCount = 0;
+
+		void AllocateChunk();
+
+	public:
+		PoolAllocator() = default;
+		~PoolAllocator();
+
+		template <typename... Args>
+		T* New(Args&&... args);
+
+		void Delete(T* object);
+
+		size_t GetLiveCount() const;
+		size_t GetCapacity() const;
+};
+
+#include "PoolAllocator.inl"
+
+#endif
\ No newline at end of file
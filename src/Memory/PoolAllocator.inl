@@ -0,0 +1,81 @@
+#include "PoolAllocator.hpp"
+#include "MemoryTracker.hpp"
+
+#include <new>
+#include <utility>
+
+template <typename T, size_t ChunkSize>
+PoolAllocator<T, ChunkSize>::~PoolAllocator()
+{
+	// objects still alive at this point are leaked on purpose:
+	// their destructors may depend on systems that are already gone
+	// (the MemoryTracker included, so the chunks are not reported as freed)
+	mFreeList = nullptr;
+	mChunks.clear();
+}
+
+template <typename T, size_t ChunkSize>
+void PoolAllocator<T, ChunkSize>::AllocateChunk()
+{
+	std::unique_ptr<Slot[]> chunk = std::make_unique<Slot[]>(ChunkSize);
+
+	// the whole chunk is accounted for, whether its slots are in use or not
+	MemoryTracker::GetInstance().Allocate(MemoryTagOf<T>::value, sizeof(Slot) * ChunkSize);
+
+	// thread the new slots into the free list, keeping them in address order
+	for (size_t i = 0; i < ChunkSize - 1; i++)
+	{
+		chunk[i].next = &chunk[i + 1];
+	}
+	chunk[ChunkSize - 1].next = mFreeList;
+
+	mFreeList = &chunk[0];
+	mChunks.push_back(std::move(chunk));
+}
+
+template <typename T, size_t ChunkSize>
+template <typename... Args>
+T* PoolAllocator<T, ChunkSize>::New(Args&&... args)
+{
+	if (mFreeList == nullptr)
+	{
+		AllocateChunk();
+	}
+
+	Slot* slot = mFreeList;
+	mFreeList  = slot->next;
+
+	T* object = new (slot->storage) T(std::forward<Args>(args)...);
+	mLiveCount++;
+
+	return object;
+}
+
+template <typename T, size_t ChunkSize>
+void PoolAllocator<T, ChunkSize>::Delete(T* object)
+{
+	if (object == nullptr)
+	{
+		return;
+	}
+
+	object->~T();
+
+	Slot* slot = reinterpret_cast<Slot*>(object);
+	slot->next = mFreeList;
+	mFreeList  = slot;
+
+	mLiveCount--;
+}
+
+template <typename T, size_t ChunkSize>
+size_t PoolAllocator<T, ChunkSize>::GetLiveCount() const
+{
+	return mLiveCount;
+}
+
+template <typename T, size_t ChunkSize>
+size_t PoolAllocator<T, ChunkSize>::GetCapacity() const
+{
+	return mChunks.size() * ChunkSize;
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef TRACKEDALLOCATOR_HPP
+#define TRACKEDALLOCATOR_HPP
+
+#include "MemoryTracker.hpp"
+#include <cstddef>
+#include <new>
+#include <vector>
+
+// standard allocator that reports every allocation to the MemoryTracker under the given tag
+template <typename T, MemoryTag Tag>
+class TrackedAllocator
+{
+	public:
+		using value_type = T;
+
+		template <typename U>
+		struct rebind
+		{
+				using other = TrackedAllocator<U, Tag>;
+		};
+
+		TrackedAllocator() = default;
+
+		template <typename U>
+		TrackedAllocator(const TrackedAllocator<U, Tag>&)
+		{
+		}
+
+		T* allocate(size_t count)
+		{
+			T* memory = static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t { alignof(T) }));
+			MemoryTracker::GetInstance().Allocate(Tag, count * sizeof(T));
+
+			return memory;
+		}
+
+		void deallocate(T* memory, size_t count)
+		{
+			MemoryTracker::GetInstance().Free(Tag, count * sizeof(T));
+			::operator delete(memory, std::align_val_t { alignof(T) });
+		}
+
+		template <typename U>
+		bool operator==(const TrackedAllocator<U, Tag>&) const
+		{
+			return true;
+		}
+};
+
+template <typename T, MemoryTag Tag>
+using TrackedVector = std::vector<T, TrackedAllocator<T, Tag>>;
+
+#endif
\ No newline at end of file
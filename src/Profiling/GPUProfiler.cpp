@@ -0,0 +1,128 @@
+#include "GPUProfiler.hpp"
+#include "Profiler.hpp"
+
+using namespace gl;
+
+GLuint GPUProfiler::TakeQuery(FrameQueries& frame)
+{
+	if (frame.used_queries == frame.queries.size())
+	{
+		GLuint query = 0;
+		glGenQueries(1, &query);
+		frame.queries.push_back(query);
+	}
+
+	return frame.queries[frame.used_queries++];
+}
+
+void GPUProfiler::Resolve(FrameQueries& frame)
+{
+	Profiler& profiler = Profiler::GetInstance();
+
+	for (const PendingZone& zone : frame.zones)
+	{
+		// never wait for the GPU, a late result is simply lost
+		GLint available = 0;
+		glGetQueryObjectiv(zone.end_query, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (available == 0)
+		{
+			continue;
+		}
+
+		GLuint64 begin = 0;
+		GLuint64 end   = 0;
+		glGetQueryObjectui64v(zone.begin_query, GL_QUERY_RESULT, &begin);
+		glGetQueryObjectui64v(zone.end_query, GL_QUERY_RESULT, &end);
+
+		profiler.Record(
+			mTrack,
+			Profiler::Zone {
+				zone.name,
+				static_cast<uint64_t>(static_cast<int64_t>(begin) + frame.clock_offset),
+				static_cast<uint64_t>(static_cast<int64_t>(end) + frame.clock_offset),
+				zone.depth,
+			});
+	}
+
+	frame.zones.clear();
+	frame.used_queries = 0;
+}
+
+void GPUProfiler::BeginFrame()
+{
+	mFrameIndex = (mFrameIndex + 1) % FRAMES_IN_FLIGHT;
+
+	// this slot was filled FRAMES_IN_FLIGHT frames ago
+	FrameQueries& frame = mFrames[mFrameIndex];
+	Resolve(frame);
+
+	mOpenGroups.clear();
+	mActive = Profiler::IsEnabled();
+
+	if (mActive == false)
+	{
+		return;
+	}
+
+	if (mTrack == -1)
+	{
+		mTrack = Profiler::GetInstance().CreateTrack("GPU");
+	}
+
+	GLint64 gpu_time = 0;
+	glGetInteger64v(GL_TIMESTAMP, &gpu_time);
+
+	frame.clock_offset = static_cast<int64_t>(Profiler::GetInstance().Now()) - gpu_time;
+}
+
+void GPUProfiler::Shutdown()
+{
+	for (FrameQueries& frame : mFrames)
+	{
+		if (frame.queries.empty() == false)
+		{
+			glDeleteQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+		}
+
+		frame.queries.clear();
+		frame.zones.clear();
+		frame.used_queries = 0;
+	}
+
+	mOpenGroups.clear();
+}
+
+void GPUProfiler::PushDebugGroup(const char* name)
+{
+	glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+
+	if (mActive == false)
+	{
+		mOpenGroups.push_back(NO_ZONE);
+		return;
+	}
+
+	FrameQueries& frame = mFrames[mFrameIndex];
+
+	PendingZone zone { name, static_cast<uint32_t>(mOpenGroups.size()), TakeQuery(frame), TakeQuery(frame) };
+	glQueryCounter(zone.begin_query, GL_TIMESTAMP);
+
+	mOpenGroups.push_back(frame.zones.size());
+	frame.zones.push_back(zone);
+}
+
+void GPUProfiler::PopDebugGroup()
+{
+	if (mOpenGroups.empty() == false)
+	{
+		size_t zone = mOpenGroups.back();
+		mOpenGroups.pop_back();
+
+		if (zone != NO_ZONE)
+		{
+			glQueryCounter(mFrames[mFrameIndex].zones[zone].end_query, GL_TIMESTAMP);
+		}
+	}
+
+	glPopDebugGroup();
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef GPUPROFILER_HPP
+#define GPUPROFILER_HPP
+
+#include <Utils/Singleton.hpp>
+#include <glbinding/gl/gl.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// debug groups timed with GL timestamp queries while the Profiler is enabled
+// results are read a few frames later, when the GPU is surely done with them, so nothing ever stalls,
+// and end up in a "GPU" track of the Profiler, moved to the CPU clock
+class GPUProfiler : public Singleton<GPUProfiler>
+{
+	public:
+		static constexpr size_t FRAMES_IN_FLIGHT = 4;
+		static constexpr size_t NO_ZONE			 = static_cast<size_t>(-1);
+
+	private:
+		struct PendingZone
+		{
+				const char* name;
+				uint32_t	depth;
+				gl::GLuint	begin_query;
+				gl::GLuint	end_query;
+		};
+
+		struct FrameQueries
+		{
+				std::vector<PendingZone> zones;
+
+				// reused every time the frame slot comes around
+				std::vector<gl::GLuint> queries;
+				size_t					used_queries = 0;
+
+				// CPU time minus GPU time when the frame began, in nanoseconds
+				int64_t clock_offset = 0;
+		};
+
+		std::array<FrameQueries, FRAMES_IN_FLIGHT> mFrames;
+		size_t									   mFrameIndex = 0;
+
+		// profiling was enabled when the current frame began
+		bool mActive = false;
+
+		// index of the zone of every open group in the current frame, NO_ZONE when it is not timed
+		std::vector<size_t> mOpenGroups;
+
+		int mTrack = -1;
+
+		gl::GLuint TakeQuery(FrameQueries& frame);
+		void	   Resolve(FrameQueries& frame);
+
+	public:
+		// from the main thread, once per frame, with the GL context current
+		void BeginFrame();
+
+		// releases the queries, while the GL context still exists
+		void Shutdown();
+
+		// glPushDebugGroup / glPopDebugGroup, timed when the profiler is enabled
+		void PushDebugGroup(const char* name);
+		void PopDebugGroup();
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,330 @@
+#include "Profiler.hpp"
+#include <Utils/JSONUtils.hpp>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string_view>
+
+namespace
+{
+	// zones currently open on this thread
+	thread_local uint32_t zone_depth = 0;
+} // namespace
+
+void Profiler::SetEnabled(bool enable)
+{
+	enabled.store(enable, std::memory_order_relaxed);
+}
+
+uint64_t Profiler::Now() const
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mEpoch).count();
+}
+
+void Profiler::BeginFrame()
+{
+	if (IsEnabled() == false)
+	{
+		return;
+	}
+
+	if (mFrameStarts.empty())
+	{
+		mFrameStarts.resize(FRAME_HISTORY);
+	}
+
+	mFrameStarts[mFrameCount % FRAME_HISTORY] = Now();
+	mFrameCount++;
+}
+
+Profiler::Track* Profiler::AddTrack(const std::string& name)
+{
+	std::lock_guard<std::mutex> lock(mTracksMutex);
+
+	mTracks.push_back(std::make_unique<Track>());
+	mTracks.back()->name = name;
+
+	return mTracks.back().get();
+}
+
+Profiler::Track& Profiler::GetThreadTrack()
+{
+	static thread_local Track* thread_track = nullptr;
+
+	if (thread_track == nullptr)
+	{
+		size_t track_count = 0;
+		{
+			std::lock_guard<std::mutex> lock(mTracksMutex);
+			track_count = mTracks.size();
+		}
+
+		thread_track = AddTrack("Thread " + std::to_string(track_count));
+	}
+
+	return *thread_track;
+}
+
+void Profiler::SetThreadName(const std::string& name)
+{
+	Track& track = GetThreadTrack();
+
+	std::lock_guard<std::mutex> lock(track.mutex);
+	track.name = name;
+}
+
+int Profiler::CreateTrack(const std::string& name)
+{
+	AddTrack(name);
+
+	std::lock_guard<std::mutex> lock(mTracksMutex);
+	return static_cast<int>(mTracks.size()) - 1;
+}
+
+void Profiler::Write(Track& track, const Zone& zone)
+{
+	std::lock_guard<std::mutex> lock(track.mutex);
+
+	// allocated on first use, threads that never record anything cost nothing
+	if (track.zones.empty())
+	{
+		track.zones.resize(ZONES_PER_TRACK);
+	}
+
+	track.zones[track.written % ZONES_PER_TRACK] = zone;
+	track.written++;
+}
+
+void Profiler::Record(const Zone& zone)
+{
+	Write(GetThreadTrack(), zone);
+}
+
+void Profiler::Record(int track, const Zone& zone)
+{
+	Track* target = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(mTracksMutex);
+		if (track < 0 || track >= static_cast<int>(mTracks.size()))
+		{
+			return;
+		}
+
+		target = mTracks[track].get();
+	}
+
+	Write(*target, zone);
+}
+
+std::vector<Profiler::Zone> Profiler::CopyZones(Track& track, uint64_t begin, uint64_t end)
+{
+	std::lock_guard<std::mutex> lock(track.mutex);
+
+	std::vector<Zone> zones;
+
+	size_t first = track.written > ZONES_PER_TRACK ? track.written - ZONES_PER_TRACK : 0;
+	for (size_t i = first; i < track.written; i++)
+	{
+		const Zone& zone = track.zones[i % ZONES_PER_TRACK];
+		if (zone.end > begin && zone.begin < end)
+		{
+			zones.push_back(zone);
+		}
+	}
+
+	return zones;
+}
+
+void Profiler::ExportChromeTrace(const std::string& path)
+{
+	std::vector<Track*> tracks;
+	{
+		std::lock_guard<std::mutex> lock(mTracksMutex);
+		for (const std::unique_ptr<Track>& track : mTracks)
+		{
+			tracks.push_back(track.get());
+		}
+	}
+
+	nlohmann::json events = nlohmann::json::array();
+	for (size_t i = 0; i < tracks.size(); i++)
+	{
+		std::string name;
+		{
+			std::lock_guard<std::mutex> lock(tracks[i]->mutex);
+			name = tracks[i]->name;
+		}
+
+		events.push_back({
+			{ "name", "thread_name" },
+			{ "ph", "M" },
+			{ "pid", 0 },
+			{ "tid", i },
+			{ "args", { { "name", name } } },
+		});
+
+		// timestamps in microseconds
+		for (const Zone& zone : CopyZones(*tracks[i], 0, UINT64_MAX))
+		{
+			events.push_back({
+				{ "name", zone.name },
+				{ "ph", "X" },
+				{ "pid", 0 },
+				{ "tid", i },
+				{ "ts", zone.begin / 1000.0 },
+				{ "dur", (zone.end - zone.begin) / 1000.0 },
+			});
+		}
+	}
+
+	SaveJSONToFile(path, { { "traceEvents", events }, { "displayTimeUnit", "ms" } });
+}
+
+void ProfileZone::Begin()
+{
+	zone_depth++;
+	mBegin = Profiler::GetInstance().Now();
+}
+
+void ProfileZone::End()
+{
+	Profiler& profiler = Profiler::GetInstance();
+
+	uint64_t end = profiler.Now();
+	zone_depth--;
+
+	profiler.Record(Profiler::Zone { mName, mBegin, end, zone_depth });
+}
+
+#include <imgui.h>
+
+namespace
+{
+	ImU32 GetZoneColor(const char* name)
+	{
+		// stable per name, dark enough for white text
+		size_t hash = std::hash<std::string_view> {}(name);
+		return IM_COL32(48 + hash % 128, 48 + (hash >> 8) % 128, 48 + (hash >> 16) % 128, 255);
+	}
+} // namespace
+
+void Profiler::Display()
+{
+	bool enable = IsEnabled();
+	if (ImGui::Checkbox("Enabled", &enable))
+	{
+		SetEnabled(enable);
+	}
+
+	ImGui::SameLine();
+	if (ImGui::Button("Export trace"))
+	{
+		ExportChromeTrace("profile.json");
+	}
+
+	// the last frame started is still in progress
+	const size_t complete_frames = mFrameCount > 0 ? std::min(mFrameCount - 1, FRAME_HISTORY - 1) : 0;
+	if (complete_frames == 0)
+	{
+		ImGui::Text("No frames recorded yet");
+		return;
+	}
+
+	ImGui::SliderInt("Frames back", &mSelectedFrame, 0, static_cast<int>(complete_frames) - 1);
+	mSelectedFrame = std::clamp(mSelectedFrame, 0, static_cast<int>(complete_frames) - 1);
+
+	const size_t   frame	   = mFrameCount - 2 - mSelectedFrame;
+	const uint64_t frame_begin = mFrameStarts[frame % FRAME_HISTORY];
+	const uint64_t frame_end   = mFrameStarts[(frame + 1) % FRAME_HISTORY];
+
+	ImGui::Text("Frame %zu: %.3f ms", frame, (frame_end - frame_begin) / 1000000.0);
+
+	std::vector<Track*> tracks;
+	{
+		std::lock_guard<std::mutex> lock(mTracksMutex);
+		for (const std::unique_ptr<Track>& track : mTracks)
+		{
+			tracks.push_back(track.get());
+		}
+	}
+
+	const float width	   = std::max(ImGui::GetContentRegionAvail().x, 1.0f);
+	const float row_height = ImGui::GetTextLineHeightWithSpacing();
+	const float scale	   = width / std::max<uint64_t>(frame_end - frame_begin, 1);
+
+	// time spent in each zone name during the frame, across every track
+	std::map<std::string, uint64_t> totals;
+
+	ImDrawList* draw_list = ImGui::GetWindowDrawList();
+	for (Track* track : tracks)
+	{
+		std::vector<Zone> zones = CopyZones(*track, frame_begin, frame_end);
+		if (zones.empty())
+		{
+			continue;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(track->mutex);
+			ImGui::Text("%s", track->name.c_str());
+		}
+
+		uint32_t max_depth = 0;
+		ImVec2	 origin	   = ImGui::GetCursorScreenPos();
+		for (const Zone& zone : zones)
+		{
+			const uint64_t begin = std::max(zone.begin, frame_begin);
+			const uint64_t end	 = std::min(zone.end, frame_end);
+
+			totals[zone.name] += end - begin;
+			max_depth		   = std::max(max_depth, zone.depth);
+
+			ImVec2 top_left		= ImVec2(origin.x + (begin - frame_begin) * scale, origin.y + zone.depth * row_height);
+			ImVec2 bottom_right = ImVec2(origin.x + (end - frame_begin) * scale, top_left.y + row_height - 1.0f);
+
+			// zones shorter than a pixel are still visible
+			bottom_right.x = std::max(bottom_right.x, top_left.x + 1.0f);
+
+			draw_list->AddRectFilled(top_left, bottom_right, GetZoneColor(zone.name));
+
+			// only when the name fits
+			if (bottom_right.x - top_left.x > ImGui::CalcTextSize(zone.name).x)
+			{
+				draw_list->AddText(top_left, IM_COL32(255, 255, 255, 255), zone.name);
+			}
+
+			if (ImGui::IsMouseHoveringRect(top_left, bottom_right))
+			{
+				ImGui::SetTooltip("%s: %.3f ms", zone.name, (zone.end - zone.begin) / 1000000.0);
+			}
+		}
+
+		ImGui::Dummy(ImVec2(width, (max_depth + 1) * row_height));
+	}
+
+	std::vector<std::pair<std::string, uint64_t>> sorted_totals(totals.begin(), totals.end());
+	std::sort(
+		sorted_totals.begin(),
+		sorted_totals.end(),
+		[](const std::pair<std::string, uint64_t>& a, const std::pair<std::string, uint64_t>& b) {
+			return a.second > b.second;
+		});
+
+	if (ImGui::BeginTable("Zones", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+	{
+		ImGui::TableSetupColumn("Zone");
+		ImGui::TableSetupColumn("Time (ms)");
+		ImGui::TableHeadersRow();
+
+		for (const std::pair<std::string, uint64_t>& total : sorted_totals)
+		{
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::Text("%s", total.first.c_str());
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", total.second / 1000000.0);
+		}
+
+		ImGui::EndTable();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <Utils/Singleton.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// records named zones into a ring buffer per thread, plus tracks fed from elsewhere (see GPUProfiler)
+// while disabled a zone costs a single relaxed load, and nothing already recorded is overwritten
+class Profiler : public Singleton<Profiler>
+{
+	public:
+		struct Zone
+		{
+				// must outlive the profiler, string literals in practice
+				const char* name;
+
+				// nanoseconds since the profiler was created
+				uint64_t begin;
+				uint64_t end;
+
+				// how many zones of the same track contain this one
+				uint32_t depth;
+		};
+
+	private:
+		struct Track
+		{
+				std::string name;
+
+				// ring buffer, the oldest zones are overwritten once it is full
+				std::vector<Zone> zones;
+				size_t			  written = 0;
+
+				// only contended while the zones are being read
+				std::mutex mutex;
+		};
+
+		static inline std::atomic<bool> enabled { false };
+
+		std::chrono::steady_clock::time_point mEpoch = std::chrono::steady_clock::now();
+
+		std::mutex							mTracksMutex;
+		std::vector<std::unique_ptr<Track>> mTracks;
+
+		// beginning of the last frames, ring buffer
+		std::vector<uint64_t> mFrameStarts;
+		size_t				  mFrameCount = 0;
+
+		// frames back from the last complete one, shown in the timeline
+		int mSelectedFrame = 0;
+
+		Track* AddTrack(const std::string& name);
+		Track& GetThreadTrack();
+		void   Write(Track& track, const Zone& zone);
+
+		// the zones of the track overlapping [begin, end), oldest first
+		std::vector<Zone> CopyZones(Track& track, uint64_t begin, uint64_t end);
+
+	public:
+		static constexpr size_t ZONES_PER_TRACK = 16384;
+		static constexpr size_t FRAME_HISTORY	= 256;
+
+		static bool IsEnabled();
+		void		SetEnabled(bool enable);
+
+		uint64_t Now() const;
+
+		// from the main thread, once per frame
+		void BeginFrame();
+
+		// the name of the calling thread in the timeline and in exported traces
+		void SetThreadName(const std::string& name);
+
+		// a track not bound to any thread, for timings measured somewhere else
+		int CreateTrack(const std::string& name);
+
+		void Record(const Zone& zone);
+		void Record(int track, const Zone& zone);
+
+		// every recorded zone in the Chrome tracing format (chrome://tracing, ui.perfetto.dev)
+		void ExportChromeTrace(const std::string& path);
+
+		void Display();
+};
+
+// measures its own lifetime, see PROFILE_ZONE
+class ProfileZone
+{
+		const char* mName;
+		uint64_t	mBegin;
+		bool		mActive;
+
+		void Begin();
+		void End();
+
+	public:
+		explicit ProfileZone(const char* name);
+		~ProfileZone();
+
+		ProfileZone(const ProfileZone&)			   = delete;
+		ProfileZone& operator=(const ProfileZone&) = delete;
+};
+
+#ifndef DISABLE_PROFILING
+#	define PROFILE_CONCAT_IMPL(a, b) a##b
+#	define PROFILE_CONCAT(a, b)	  PROFILE_CONCAT_IMPL(a, b)
+#	define PROFILE_ZONE(name)		  ProfileZone PROFILE_CONCAT(profile_zone_, __LINE__) { name }
+#else
+#	define PROFILE_ZONE(name)
+#endif
+
+#include "Profiler.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "Profiler.hpp"
+
+inline bool Profiler::IsEnabled()
+{
+	return enabled.load(std::memory_order_relaxed);
+}
+
+inline ProfileZone::ProfileZone(const char* name)
+	: mName { name }, mBegin { 0 }, mActive { Profiler::IsEnabled() }
+{
+	if (mActive)
+	{
+		Begin();
+	}
+}
+
+inline ProfileZone::~ProfileZone()
+{
+	if (mActive)
+	{
+		End();
+	}
+}
\ No newline at end of file
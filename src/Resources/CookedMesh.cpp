@@ -0,0 +1,321 @@
+#include "CookedMesh.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+namespace
+{
+	constexpr uint64_t STREAM_ALIGNMENT = 16;
+
+	uint64_t AlignOffset(uint64_t offset)
+	{
+		return (offset + STREAM_ALIGNMENT - 1) & ~(STREAM_ALIGNMENT - 1);
+	}
+
+	// FNV-1a
+	uint64_t HashBytes(const uint8_t* data, size_t size)
+	{
+		uint64_t hash = 0xCBF29CE484222325ull;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= data[i];
+			hash *= 0x100000001B3ull;
+		}
+
+		return hash;
+	}
+
+	uint64_t HashFile(const std::string& filepath)
+	{
+		MappedFile file;
+		file.Open(filepath);
+
+		return HashBytes(file.GetData(), file.GetSize());
+	}
+
+	bool GetSourceInfo(const std::string& filepath, int64_t& write_time, uint64_t& size)
+	{
+		std::error_code error;
+
+		std::filesystem::file_time_type time = std::filesystem::last_write_time(filepath, error);
+		if (error)
+		{
+			return false;
+		}
+
+		size = std::filesystem::file_size(filepath, error);
+		if (error)
+		{
+			return false;
+		}
+
+		write_time = static_cast<int64_t>(time.time_since_epoch().count());
+		return true;
+	}
+
+	// the source was touched without changing (a checkout, a copy), so that it is not hashed every time
+	void UpdateSourceWriteTime(const std::string& cooked_filepath, int64_t write_time)
+	{
+		std::fstream file { cooked_filepath, std::ios::in | std::ios::out | std::ios::binary };
+		if (file.is_open() == false)
+		{
+			return;
+		}
+
+		file.seekp(offsetof(CookedMeshHeader, source_write_time));
+		file.write(reinterpret_cast<const char*>(&write_time), sizeof(write_time));
+	}
+
+	// several threads (or instances of the program) may cook the same mesh at once, each one writes its own file
+	std::string GetTemporaryPath(const std::string& filepath)
+	{
+		static std::atomic<uint32_t> counter { 0 };
+
+		std::random_device random;
+		return filepath + "." + std::to_string(random()) + "-" + std::to_string(counter++) + ".tmp";
+	}
+
+	void WritePadding(std::ofstream& file, uint64_t offset)
+	{
+		static constexpr char zeros[STREAM_ALIGNMENT] = {};
+
+		uint64_t position = static_cast<uint64_t>(file.tellp());
+		file.write(zeros, static_cast<std::streamsize>(offset - position));
+	}
+} // namespace
+
+bool CookedMesh::Open(
+	const std::string& cooked_filepath, const std::string& source_filepath, MeshOptimization optimization)
+{
+	Close();
+
+	if (mFile.Open(cooked_filepath) == false || mFile.GetSize() < sizeof(CookedMeshHeader))
+	{
+		Close();
+		return false;
+	}
+
+	const CookedMeshHeader* header = reinterpret_cast<const CookedMeshHeader*>(mFile.GetData());
+
+	const uint64_t vertex_stream_end = header->vertex_offset + uint64_t { header->vertex_count } * sizeof(Vertex);
+	const uint64_t index_stream_end	 = header->index_offset + uint64_t { header->index_count } * sizeof(unsigned int);
+
+	// checked before looking at the source, a cooked only mesh has to match as well
+	if (header->magic != CookedMeshHeader::MAGIC || header->version != CookedMeshHeader::VERSION
+		|| header->vertex_size != sizeof(Vertex) || header->optimization != static_cast<uint32_t>(optimization)
+		|| header->index_count == 0 || vertex_stream_end > mFile.GetSize() || index_stream_end > mFile.GetSize())
+	{
+		Close();
+		return false;
+	}
+
+	// without a source the cooked file is all there is, meshes can be shipped cooked only
+	int64_t	 source_write_time;
+	uint64_t source_size;
+	if (GetSourceInfo(source_filepath, source_write_time, source_size) == false)
+	{
+		mHeader = header;
+		return true;
+	}
+
+	if (header->source_size != source_size)
+	{
+		Close();
+		return false;
+	}
+
+	if (header->source_write_time != source_write_time)
+	{
+		if (header->source_hash != HashFile(source_filepath))
+		{
+			Close();
+			return false;
+		}
+
+		// the mapping is read-only, and on some platforms prevents writing to the file
+		mFile.Close();
+		UpdateSourceWriteTime(cooked_filepath, source_write_time);
+
+		if (mFile.Open(cooked_filepath) == false || mFile.GetSize() < sizeof(CookedMeshHeader))
+		{
+			Close();
+			return false;
+		}
+
+		header = reinterpret_cast<const CookedMeshHeader*>(mFile.GetData());
+	}
+
+	mHeader = header;
+	return true;
+}
+
+void CookedMesh::Close()
+{
+	mFile.Close();
+	mHeader = nullptr;
+}
+
+bool CookedMesh::IsOpen() const
+{
+	return mHeader != nullptr;
+}
+
+MeshView CookedMesh::GetView() const
+{
+	const uint8_t* data = mFile.GetData();
+
+	MeshView view;
+	view.vertices	  = reinterpret_cast<const Vertex*>(data + mHeader->vertex_offset);
+	view.vertex_count = mHeader->vertex_count;
+	view.indices	  = reinterpret_cast<const unsigned int*>(data + mHeader->index_offset);
+	view.index_count  = mHeader->index_count;
+	view.bounds_min	  = glm::vec3 { mHeader->bounds_min[0], mHeader->bounds_min[1], mHeader->bounds_min[2] };
+	view.bounds_max	  = glm::vec3 { mHeader->bounds_max[0], mHeader->bounds_max[1], mHeader->bounds_max[2] };
+
+	return view;
+}
+
+std::string GetCookedMeshPath(const std::string& source_filepath, MeshOptimization optimization)
+{
+	switch (optimization)
+	{
+		case MeshOptimization::VERTEX_CACHE: return source_filepath + ".vcache.cooked";
+		case MeshOptimization::VERTEX_CACHE_AND_OVERDRAW: return source_filepath + ".overdraw.cooked";
+		default: return source_filepath + ".cooked";
+	}
+}
+
+bool CookMesh(
+	const std::string& source_filepath,
+	const MeshData&	   mesh,
+	const std::string& cooked_filepath,
+	MeshOptimization   optimization)
+{
+	// nothing to draw, better not to hide the fallback of the caller behind an empty cooked file
+	if (mesh.indices.empty())
+	{
+		return false;
+	}
+
+	MeshView view = GetMeshView(mesh);
+
+	CookedMeshHeader header;
+	std::memset(&header, 0, sizeof(header));
+	header.magic		 = CookedMeshHeader::MAGIC;
+	header.version		 = CookedMeshHeader::VERSION;
+	header.vertex_size	 = sizeof(Vertex);
+	header.vertex_count	 = static_cast<uint32_t>(view.vertex_count);
+	header.index_count	 = static_cast<uint32_t>(view.index_count);
+	header.optimization	 = static_cast<uint32_t>(optimization);
+	header.vertex_offset = AlignOffset(sizeof(CookedMeshHeader));
+	header.index_offset	 = AlignOffset(header.vertex_offset + uint64_t { header.vertex_count } * sizeof(Vertex));
+	header.source_hash	 = HashFile(source_filepath);
+
+	if (GetSourceInfo(source_filepath, header.source_write_time, header.source_size) == false)
+	{
+		return false;
+	}
+
+	for (int i = 0; i < 3; i++)
+	{
+		header.bounds_min[i] = view.bounds_min[i];
+		header.bounds_max[i] = view.bounds_max[i];
+	}
+
+	// written next to it and renamed, so that a half written file is never picked up
+	const std::string temporary_filepath = GetTemporaryPath(cooked_filepath);
+	{
+		std::ofstream file { temporary_filepath, std::ios::out | std::ios::binary | std::ios::trunc };
+		if (file.is_open() == false)
+		{
+			std::cerr << "Could not open the file \"" << temporary_filepath << "\"." << std::endl;
+			return false;
+		}
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		WritePadding(file, header.vertex_offset);
+		file.write(
+			reinterpret_cast<const char*>(view.vertices),
+			static_cast<std::streamsize>(view.vertex_count * sizeof(Vertex)));
+
+		WritePadding(file, header.index_offset);
+		file.write(
+			reinterpret_cast<const char*>(view.indices),
+			static_cast<std::streamsize>(view.index_count * sizeof(unsigned int)));
+
+		if (file.good() == false)
+		{
+			std::cerr << "Could not write the cooked mesh \"" << temporary_filepath << "\"." << std::endl;
+			file.close();
+			std::filesystem::remove(temporary_filepath);
+			return false;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporary_filepath, cooked_filepath, error);
+	if (error)
+	{
+		std::cerr << "Could not write the cooked mesh \"" << cooked_filepath << "\": " << error.message() << std::endl;
+		std::filesystem::remove(temporary_filepath, error);
+		return false;
+	}
+
+	return true;
+}
+
+bool LoadCookedMesh(
+	const std::string&	   source_filepath,
+	CookedMesh&			   cooked,
+	MeshData&			   fallback,
+	MeshOptimization	   optimization,
+	MeshOptimizationStats* stats)
+{
+	const std::string cooked_filepath = GetCookedMeshPath(source_filepath, optimization);
+
+	if (cooked.Open(cooked_filepath, source_filepath, optimization))
+	{
+		return true;
+	}
+
+	std::error_code error;
+	if (std::filesystem::exists(source_filepath, error) == false)
+	{
+		return false;
+	}
+
+	LoadModel(source_filepath, fallback.vertices, fallback.indices);
+
+	// the file could not be parsed, or holds no faces
+	if (fallback.indices.empty())
+	{
+		fallback = MeshData {};
+		return false;
+	}
+
+	// done once here, the cooked file keeps the result
+	// no printing, this usually runs on a worker
+	if (optimization != MeshOptimization::NONE)
+	{
+		MeshOptimizationStats optimization_stats = OptimizeMesh(fallback, optimization);
+		if (stats != nullptr)
+		{
+			*stats = optimization_stats;
+		}
+	}
+
+	if (CookMesh(source_filepath, fallback, cooked_filepath, optimization) == false
+		|| cooked.Open(cooked_filepath, source_filepath, optimization) == false)
+	{
+		return false;
+	}
+
+	// the mapped copy is used from now on
+	fallback = MeshData {};
+	return true;
+}
\ No newline at end of file
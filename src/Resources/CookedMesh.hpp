@@ -0,0 +1,79 @@
+#ifndef COOKEDMESH_HPP
+#define COOKEDMESH_HPP
+
+#include "MeshLoader.hpp"
+#include "MeshOptimizer.hpp"
+#include <Utils/MappedFile.hpp>
+#include <cstdint>
+#include <string>
+
+// binary copy of a parsed mesh, laid out so that the streams can be uploaded straight from the mapped file:
+// header, vertex stream, index stream (each one 16 byte aligned)
+// the header remembers the source it was cooked from, so a changed source is cooked again
+struct CookedMeshHeader
+{
+		static constexpr uint32_t MAGIC	  = 0x4D585350; // "PSXM"
+		static constexpr uint32_t VERSION = 1;
+
+		uint32_t magic;
+		uint32_t version;
+
+		// a change in the Vertex layout invalidates the file as well
+		uint32_t vertex_size;
+		uint32_t vertex_count;
+		uint32_t index_count;
+
+		// a MeshOptimization, cooked files from before it was stored have 0 (none)
+		uint32_t optimization;
+
+		uint64_t vertex_offset;
+		uint64_t index_offset;
+
+		// last write time and size are checked first, the hash only when they differ
+		int64_t	 source_write_time;
+		uint64_t source_size;
+		uint64_t source_hash;
+
+		float bounds_min[3];
+		float bounds_max[3];
+};
+
+class CookedMesh
+{
+		MappedFile				mFile;
+		const CookedMeshHeader* mHeader = nullptr;
+
+	public:
+		// false if it is missing, broken, empty, from another version, older than its source or optimized differently
+		bool Open(
+			const std::string& cooked_filepath,
+			const std::string& source_filepath,
+			MeshOptimization   optimization = MeshOptimization::NONE);
+		void Close();
+
+		bool	 IsOpen() const;
+		MeshView GetView() const;
+};
+
+// where the cooked version of a mesh file is kept, every optimization has its own
+std::string GetCookedMeshPath(
+	const std::string& source_filepath, MeshOptimization optimization = MeshOptimization::NONE);
+
+bool CookMesh(
+	const std::string& source_filepath,
+	const MeshData&	   mesh,
+	const std::string& cooked_filepath,
+	MeshOptimization   optimization = MeshOptimization::NONE);
+
+// opens the cooked version of the file, parsing, optimizing and cooking it first when it is missing or stale
+// if it cannot be written the parsed mesh is left in fallback instead, false with an empty fallback if the
+// source holds no triangles
+// stats, when given, receives the ACMR before and after if the mesh had to be optimized (untouched otherwise)
+bool LoadCookedMesh(
+	const std::string&	   source_filepath,
+	CookedMesh&			   cooked,
+	MeshData&			   fallback,
+	MeshOptimization	   optimization = MeshOptimization::NONE,
+	MeshOptimizationStats* stats		= nullptr);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include "ImageLoader.hpp"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+bool DecodeImage(const std::string& filepath, ImageData& image)
+{
+	glm::ivec2 size;
+	int		   comp;
+
+	uint8_t* data = stbi_load(filepath.c_str(), &size.x, &size.y, &comp, 4);
+	if (data == nullptr)
+	{
+		return false;
+	}
+
+	image.size = size;
+	image.pixels.reset(data);
+
+	return true;
+}
+
+void GenerateDummyImage(glm::ivec2 size, ImageData& image)
+{
+	int		 width	= size.x;
+	int		 height = size.y;
+	uint8_t* data	= static_cast<uint8_t*>(std::malloc(width * height * 4));
+
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			uint8_t color = (x + y) % 2 == 0 ? 255 : 0;
+
+			data[(y * width + x) * 4 + 0] = color;
+			data[(y * width + x) * 4 + 1] = color;
+			data[(y * width + x) * 4 + 2] = color;
+			data[(y * width + x) * 4 + 3] = color;
+		}
+	}
+
+	image.size = size;
+	image.pixels.reset(data);
+}
\ No newline at end of file
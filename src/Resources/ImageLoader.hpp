@@ -0,0 +1,25 @@
+#ifndef IMAGELOADER_HPP
+#define IMAGELOADER_HPP
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+// pixels on the CPU side only, Texture uploads them
+struct ImageData
+{
+		glm::ivec2 size { 0, 0 };
+
+		// RGBA8, allocated with malloc (as stb_image does)
+		std::unique_ptr<uint8_t, void (*)(void*)> pixels { nullptr, &std::free };
+};
+
+// false if the file cannot be opened or decoded
+bool DecodeImage(const std::string& filepath, ImageData& image);
+
+// black and white checkerboard, shown instead of missing images
+void GenerateDummyImage(glm::ivec2 size, ImageData& image);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,374 @@
+#include "MeshLoader.hpp"
+
+#include "VertexIndexMap.hpp"
+#include <Utils/JobSystem.hpp>
+#include <glm/gtc/packing.hpp>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <tuple>
+
+#define TINYOBJLOADER_IMPLEMENTATION
+#include <tiny_obj_loader.h>
+
+namespace
+{
+	// the vertices and indices of a single shape, indices relative to that shape
+	struct ShapeMesh
+	{
+			std::vector<Vertex>		  vertices;
+			std::vector<unsigned int> indices;
+
+			// kept for the attribute indices of every vertex (its keys), needed when merging
+			std::optional<VertexIndexMap> unique_vertices;
+
+			// shape vertex -> final vertex, filled when merging
+			std::vector<unsigned int> remap;
+	};
+
+	Vertex ReadVertex(const tinyobj::attrib_t& attrib, const tinyobj::index_t& idx)
+	{
+		Vertex vertex {};
+
+		tinyobj::real_t vx = attrib.vertices[3 * size_t(idx.vertex_index) + 0];
+		tinyobj::real_t vy = attrib.vertices[3 * size_t(idx.vertex_index) + 1];
+		tinyobj::real_t vz = attrib.vertices[3 * size_t(idx.vertex_index) + 2];
+
+		vertex.position = glm::vec3 { vx, vy, vz };
+
+		// check if `normal_index` is zero or positive. negative = no normal data
+		if (idx.normal_index >= 0)
+		{
+			tinyobj::real_t nx = attrib.normals[3 * size_t(idx.normal_index) + 0];
+			tinyobj::real_t ny = attrib.normals[3 * size_t(idx.normal_index) + 1];
+			tinyobj::real_t nz = attrib.normals[3 * size_t(idx.normal_index) + 2];
+
+			vertex.normal = glm::vec3 { nx, ny, nz };
+		}
+
+		// check if `texcoord_index` is zero or positive. negative = no texcoord data
+		if (idx.texcoord_index >= 0)
+		{
+			tinyobj::real_t tx = attrib.texcoords[2 * size_t(idx.texcoord_index) + 0];
+			tinyobj::real_t ty = attrib.texcoords[2 * size_t(idx.texcoord_index) + 1];
+
+			vertex.textureCoordinates = glm::vec2 { tx, ty };
+		}
+
+		// vertex colors
+		// there should always be color, even if default
+		tinyobj::real_t red	  = attrib.colors[3 * size_t(idx.vertex_index) + 0];
+		tinyobj::real_t green = attrib.colors[3 * size_t(idx.vertex_index) + 1];
+		tinyobj::real_t blue  = attrib.colors[3 * size_t(idx.vertex_index) + 2];
+
+		vertex.color = glm::vec3 { red, green, blue };
+
+		return vertex;
+	}
+
+	// only reads the shared attributes, so shapes can be built at the same time
+	void BuildShapeMesh(const tinyobj::attrib_t& attrib, const tinyobj::shape_t& shape, ShapeMesh& shape_mesh)
+	{
+		// triangulated by the reader
+		constexpr size_t fv = 3;
+
+		shape_mesh.indices.reserve(shape.mesh.indices.size());
+
+		// every corner could be a different vertex
+		VertexIndexMap& unique_vertices = shape_mesh.unique_vertices.emplace(shape.mesh.indices.size());
+
+		// loop over faces(polygon)
+		size_t index_offset		 = 0;
+		size_t num_face_vertices = shape.mesh.num_face_vertices.size();
+		for (size_t f = 0; f < num_face_vertices; f++)
+		{
+			// loop over vertices in the face
+			for (size_t v = 0; v < fv; v++)
+			{
+				// access to vertex
+				tinyobj::index_t	idx = shape.mesh.indices[index_offset + v];
+				VertexIndexMap::Key key { idx.vertex_index, idx.normal_index, idx.texcoord_index };
+
+				bool inserted = false;
+				shape_mesh.indices.push_back(unique_vertices.FindOrInsert(key, inserted));
+
+				if (inserted)
+				{
+					shape_mesh.vertices.push_back(ReadVertex(attrib, idx));
+				}
+			}
+
+			index_offset += fv;
+
+			// per-face material
+			//shape.mesh.material_ids[f];
+		}
+	}
+} // namespace
+
+MeshView GetMeshView(const MeshData& mesh)
+{
+	MeshView view;
+	view.vertices	  = mesh.vertices.data();
+	view.vertex_count = mesh.vertices.size();
+	view.indices	  = mesh.indices.data();
+	view.index_count  = mesh.indices.size();
+	view.bounds_min	  = glm::vec3 { 0.0f };
+	view.bounds_max	  = glm::vec3 { 0.0f };
+
+	if (mesh.vertices.empty() == false)
+	{
+		view.bounds_min = mesh.vertices.front().position;
+		view.bounds_max = mesh.vertices.front().position;
+	}
+
+	for (const Vertex& vertex : mesh.vertices)
+	{
+		view.bounds_min = glm::min(view.bounds_min, vertex.position);
+		view.bounds_max = glm::max(view.bounds_max, vertex.position);
+	}
+
+	return view;
+}
+
+void PackVertices(const MeshView& mesh, std::vector<PackedVertex>& vertices)
+{
+	glm::vec3 extent = mesh.bounds_max - mesh.bounds_min;
+
+	// flat meshes have no extent along some axis, every position is at the minimum there
+	glm::vec3 inverse_extent { 0.0f };
+	for (int axis = 0; axis < 3; axis++)
+	{
+		if (extent[axis] > 0.0f)
+		{
+			inverse_extent[axis] = 1.0f / extent[axis];
+		}
+	}
+
+	vertices.resize(mesh.vertex_count);
+
+	for (size_t i = 0; i < mesh.vertex_count; i++)
+	{
+		const Vertex& vertex = mesh.vertices[i];
+		PackedVertex& packed = vertices[i];
+
+		glm::vec3 position = (vertex.position - mesh.bounds_min) * inverse_extent;
+		packed.position[0] = glm::packUnorm1x16(position.x);
+		packed.position[1] = glm::packUnorm1x16(position.y);
+		packed.position[2] = glm::packUnorm1x16(position.z);
+		packed.position[3] = 0;
+
+		packed.color			  = glm::packUnorm4x8(glm::vec4 { vertex.color, 1.0f });
+		packed.textureCoordinates = glm::packHalf2x16(vertex.textureCoordinates);
+		packed.normal			  = glm::packSnorm3x10_1x2(glm::vec4 { vertex.normal, 0.0f });
+	}
+}
+
+void LoadModel(const std::string& filepath, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+{
+	tinyobj::ObjReaderConfig reader_config;
+	reader_config.mtl_search_path = "./"; // path to material files
+	reader_config.vertex_color	  = true;
+
+	reader_config.triangulate = true;
+
+	// needs to import earcut into the project!
+	//reader_config.triangulation_method = "earcut";
+
+	tinyobj::ObjReader reader;
+
+	if (!reader.ParseFromFile(filepath, reader_config))
+	{
+		if (!reader.Error().empty())
+		{
+			std::cerr << "TinyObjReader: " << reader.Error();
+		}
+
+		return;
+	}
+
+	if (!reader.Warning().empty())
+	{
+		std::cout << "TinyObjReader: " << reader.Warning();
+	}
+
+	const tinyobj::attrib_t&			 attrib = reader.GetAttrib();
+	const std::vector<tinyobj::shape_t>& shapes = reader.GetShapes();
+
+	// shapes do not depend on each other, every one is built on its own
+	std::vector<ShapeMesh> shape_meshes(shapes.size());
+	JobSystem::GetInstance().ParallelFor(shapes.size(), 1, [&](size_t begin, size_t end) {
+		for (size_t s = begin; s < end; s++)
+		{
+			BuildShapeMesh(attrib, shapes[s], shape_meshes[s]);
+		}
+	});
+
+	// nothing to share with other shapes
+	if (shape_meshes.size() == 1)
+	{
+		vertices = std::move(shape_meshes.front().vertices);
+		indices	 = std::move(shape_meshes.front().indices);
+		return;
+	}
+
+	size_t vertex_count = 0;
+	size_t index_count	= 0;
+	for (const ShapeMesh& shape_mesh : shape_meshes)
+	{
+		vertex_count += shape_mesh.vertices.size();
+		index_count	 += shape_mesh.indices.size();
+	}
+
+	vertices.reserve(vertex_count);
+	indices.resize(index_count);
+
+	// shapes may share vertices as well, merging them in order hands out the same indices as a single pass would
+	VertexIndexMap unique_vertices { vertex_count };
+	for (ShapeMesh& shape_mesh : shape_meshes)
+	{
+		const std::vector<VertexIndexMap::Key>& keys = shape_mesh.unique_vertices->GetKeys();
+
+		shape_mesh.remap.resize(shape_mesh.vertices.size());
+
+		for (size_t i = 0; i < shape_mesh.vertices.size(); i++)
+		{
+			bool inserted		= false;
+			shape_mesh.remap[i] = unique_vertices.FindOrInsert(keys[i], inserted);
+
+			if (inserted)
+			{
+				vertices.push_back(shape_mesh.vertices[i]);
+			}
+		}
+	}
+
+	// every shape rebases its own indices into its range of the final ones
+	std::vector<size_t> index_offsets(shape_meshes.size());
+	for (size_t s = 1; s < shape_meshes.size(); s++)
+	{
+		index_offsets[s] = index_offsets[s - 1] + shape_meshes[s - 1].indices.size();
+	}
+
+	JobSystem::GetInstance().ParallelFor(shape_meshes.size(), 1, [&](size_t begin, size_t end) {
+		for (size_t s = begin; s < end; s++)
+		{
+			const ShapeMesh& shape_mesh = shape_meshes[s];
+			for (size_t i = 0; i < shape_mesh.indices.size(); i++)
+			{
+				indices[index_offsets[s] + i] = shape_mesh.remap[shape_mesh.indices[i]];
+			}
+		}
+	});
+}
+
+void CreateCube(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+{
+	constexpr glm::vec3 white { 1.0f, 1.0f, 1.0f };
+
+	constexpr glm::vec3 positions[] {
+		{ -0.5f, 0.5f,  0.5f	}, // 0 - left top near
+		{ -0.5f, -0.5f, 0.5f	 }, // 1 - left bottom near
+		{ 0.5f,	-0.5f, 0.5f	}, // 2 - right bottom near
+		{ 0.5f,	0.5f,  0.5f  }, // 3 - right top near
+		{ 0.5f,	0.5f,  -0.5f }, // 4 - right top far
+		{ 0.5f,	-0.5f, -0.5f }, // 5 - right bottom far
+		{ -0.5f, -0.5f, -0.5f }, // 6 - left bottom far
+		{ -0.5f, 0.5f,  -0.5f }, // 7 - left top far
+	};
+
+	constexpr glm::vec2 uvs[] {
+		{ 0.0f, 1.0f }, // 0 - top-left
+		{ 0.0f, 0.0f }, // 1 - bottom-left
+		{ 1.0f, 0.0f }, // 2 - bottom-right
+		{ 1.0f, 1.0f }, // 3 - top-right
+	};
+
+	constexpr glm::vec3 normals[] {
+		{ 0.0f,	1.0f,  0.0f  }, // 0 - top
+		{ 0.0f,	-1.0f, 0.0f	}, // 1 - bottom
+		{ -1.0f, 0.0f,  0.0f	}, // 2 - left
+		{ 1.0f,	0.0f,  0.0f  }, // 3 - right
+		{ 0.0f,	0.0f,  1.0f  }, // 4 - inward
+		{ 0.0f,	0.0f,  -1.0f }, // 5 - outward
+	};
+
+	// position, uv, normal
+	constexpr std::tuple<int, int, int> index_tuples[] {
+		{ 0, 0, 5 },
+		 { 1, 1, 5 },
+		  { 2, 2, 5 },
+		   { 0, 0, 5 },
+		{ 2, 2, 5 },
+		 { 3, 3, 5 },
+
+		{ 3, 0, 3 },
+		 { 2, 1, 3 },
+		  { 5, 2, 3 },
+		   { 3, 0, 3 },
+		{ 5, 2, 3 },
+		 { 4, 3, 3 },
+
+		{ 4, 0, 4 },
+		 { 5, 1, 4 },
+		  { 6, 2, 4 },
+		   { 4, 0, 4 },
+		{ 6, 2, 4 },
+		 { 7, 3, 4 },
+
+		{ 7, 0, 2 },
+		 { 6, 1, 2 },
+		  { 1, 2, 2 },
+		   { 7, 0, 2 },
+		{ 1, 2, 2 },
+		 { 0, 3, 2 },
+
+		{ 7, 0, 0 },
+		 { 0, 1, 0 },
+		  { 3, 2, 0 },
+		   { 7, 0, 0 },
+		{ 3, 2, 0 },
+		 { 4, 3, 0 },
+
+		{ 1, 0, 1 },
+		 { 6, 1, 1 },
+		  { 5, 2, 1 },
+		   { 1, 0, 1 },
+		{ 5, 2, 1 },
+		 { 2, 3, 1 },
+	};
+
+	VertexIndexMap unique_indices { std::size(index_tuples) };
+
+	for (const std::tuple<int, int, int>& index_tuple : index_tuples)
+	{
+		VertexIndexMap::Key key { std::get<0>(index_tuple), std::get<2>(index_tuple), std::get<1>(index_tuple) };
+
+		bool inserted = false;
+		indices.push_back(unique_indices.FindOrInsert(key, inserted));
+
+		if (inserted == false)
+		{
+			continue;
+		}
+
+		vertices.push_back(Vertex {
+			positions[std::get<0>(index_tuple)],
+			white,
+			uvs[std::get<1>(index_tuple)],
+			normals[std::get<2>(index_tuple)],
+		});
+	}
+}
+
+void CreateQuad(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+{
+	vertices = {
+		{ { -0.5f, 0.5f, 0.0f },	 { 1.0f, 1.0f, 1.0f }, { 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f } },
+		{ { -0.5f, -0.5f, 0.0f }, { 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } },
+		{ { 0.5f, -0.5f, 0.0f },	 { 1.0f, 1.0f, 1.0f }, { 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } },
+		{ { 0.5f, 0.5f, 0.0f },	{ 1.0f, 1.0f, 1.0f }, { 1.0f, 1.0f }, { 0.0f, 0.0f, 1.0f } },
+	};
+
+	indices = { 0, 1, 2, 0, 2, 3 };
+}
\ No newline at end of file
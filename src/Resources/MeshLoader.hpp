@@ -0,0 +1,41 @@
+#ifndef MESHLOADER_HPP
+#define MESHLOADER_HPP
+
+#include "Vertex.hpp"
+#include <string>
+#include <vector>
+
+// geometry on the CPU side only, Model uploads it
+struct MeshData
+{
+		std::vector<Vertex>		  vertices;
+		std::vector<unsigned int> indices;
+};
+
+// geometry owned by someone else, a MeshData or a cooked mesh file
+struct MeshView
+{
+		const Vertex*		vertices;
+		size_t				vertex_count;
+		const unsigned int* indices;
+		size_t				index_count;
+
+		glm::vec3 bounds_min;
+		glm::vec3 bounds_max;
+};
+
+// computes the bounds
+MeshView GetMeshView(const MeshData& mesh);
+
+// positions are stored relative to the bounds of the view, the shaders get them back with
+// bounds_min + position * (bounds_max - bounds_min)
+void PackVertices(const MeshView& mesh, std::vector<PackedVertex>& vertices);
+
+// faces sharing position, normal and uv indices share the vertex
+// shapes are built in parallel on the JobSystem, the result is the same as building them one after the other
+void LoadModel(const std::string& filepath, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+
+void CreateCube(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+void CreateQuad(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+
+#endif
\ No newline at end of file
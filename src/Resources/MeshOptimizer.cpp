@@ -0,0 +1,427 @@
+#include "MeshOptimizer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+	constexpr unsigned int INVALID_INDEX = ~0u;
+
+	// the cache that is measured, most GPUs behave close to a small FIFO
+	constexpr unsigned int FIFO_CACHE_SIZE = 16;
+
+	// the cache the Forsyth scores are tuned for
+	constexpr int	LRU_CACHE_SIZE		= 32;
+	constexpr float CACHE_DECAY_POWER	= 1.5f;
+	constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+	constexpr float VALENCE_BOOST_SCALE = 2.0f;
+	constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+	// what OptimizeMesh() gives up in vertex cache hits to sort the clusters
+	constexpr float OVERDRAW_THRESHOLD = 1.05f;
+
+	// a vertex only enters on a miss, and stays for the next FIFO_CACHE_SIZE misses
+	struct FifoCache
+	{
+			std::vector<unsigned int> timestamps;
+			unsigned int			  time;
+
+			FifoCache(size_t vertex_count)
+				: timestamps(vertex_count, 0), time { FIFO_CACHE_SIZE + 1 }
+			{
+			}
+
+			bool Miss(unsigned int vertex)
+			{
+				if (time - timestamps[vertex] <= FIFO_CACHE_SIZE)
+				{
+					return false;
+				}
+
+				timestamps[vertex] = time++;
+				return true;
+			}
+
+			// everything in it gets too old
+			void Flush()
+			{
+				time += FIFO_CACHE_SIZE + 1;
+			}
+	};
+
+	float GetVertexScore(int cache_position, unsigned int remaining_triangles)
+	{
+		// nothing left to draw with it
+		if (remaining_triangles == 0)
+		{
+			return -1.0f;
+		}
+
+		float score = 0.0f;
+		if (cache_position >= 0)
+		{
+			// the vertices of the last triangle get a fixed score, it is not good to reuse them right away
+			if (cache_position < 3)
+			{
+				score = LAST_TRIANGLE_SCORE;
+			}
+			else
+			{
+				float recency = 1.0f - static_cast<float>(cache_position - 3) / (LRU_CACHE_SIZE - 3);
+				score		  = std::pow(recency, CACHE_DECAY_POWER);
+			}
+		}
+
+		// vertices with few triangles left are finished first, so that they leave the cache for good
+		score += VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remaining_triangles), -VALENCE_BOOST_POWER);
+
+		return score;
+	}
+} // namespace
+
+float ComputeACMR(const std::vector<unsigned int>& indices, size_t vertex_count)
+{
+	size_t triangle_count = indices.size() / 3;
+	if (triangle_count == 0)
+	{
+		return 0.0f;
+	}
+
+	FifoCache cache { vertex_count };
+
+	size_t misses = 0;
+	for (unsigned int index : indices)
+	{
+		misses += cache.Miss(index);
+	}
+
+	return static_cast<float>(misses) / static_cast<float>(triangle_count);
+}
+
+void OptimizeVertexCache(std::vector<unsigned int>& indices, size_t vertex_count)
+{
+	size_t triangle_count = indices.size() / 3;
+	if (triangle_count == 0)
+	{
+		return;
+	}
+
+	// triangles of every vertex, the ones still to draw are kept first
+	std::vector<unsigned int> triangle_offsets(vertex_count + 1, 0);
+	for (unsigned int index : indices)
+	{
+		triangle_offsets[index + 1]++;
+	}
+
+	for (size_t vertex = 0; vertex < vertex_count; vertex++)
+	{
+		triangle_offsets[vertex + 1] += triangle_offsets[vertex];
+	}
+
+	std::vector<unsigned int> remaining_triangles(vertex_count);
+	std::vector<unsigned int> vertex_triangles(indices.size());
+	for (size_t i = 0; i < indices.size(); i++)
+	{
+		unsigned int vertex = indices[i];
+		vertex_triangles[triangle_offsets[vertex] + remaining_triangles[vertex]++] = static_cast<unsigned int>(i / 3);
+	}
+
+	std::vector<int>   cache_positions(vertex_count, -1);
+	std::vector<float> vertex_scores(vertex_count);
+	for (size_t vertex = 0; vertex < vertex_count; vertex++)
+	{
+		vertex_scores[vertex] = GetVertexScore(-1, remaining_triangles[vertex]);
+	}
+
+	std::vector<float> triangle_scores(triangle_count, 0.0f);
+	std::vector<bool>  drawn(triangle_count, false);
+	for (size_t i = 0; i < indices.size(); i++)
+	{
+		triangle_scores[i / 3] += vertex_scores[indices[i]];
+	}
+
+	// the triangle just drawn goes first, then the rest of the cache, the last ones fall out
+	std::vector<unsigned int> cache;
+	std::vector<unsigned int> new_cache;
+	cache.reserve(LRU_CACHE_SIZE + 3);
+	new_cache.reserve(LRU_CACHE_SIZE + 3);
+
+	std::vector<unsigned int> optimized_indices;
+	optimized_indices.reserve(indices.size());
+
+	unsigned int best_triangle = static_cast<unsigned int>(
+		std::max_element(triangle_scores.begin(), triangle_scores.end()) - triangle_scores.begin());
+	size_t next_unused = 0;
+
+	for (size_t drawn_count = 0; drawn_count < triangle_count; drawn_count++)
+	{
+		// nothing in the cache has triangles left, continue in the original order
+		if (best_triangle == INVALID_INDEX)
+		{
+			while (drawn[next_unused])
+			{
+				next_unused++;
+			}
+
+			best_triangle = static_cast<unsigned int>(next_unused);
+		}
+
+		drawn[best_triangle] = true;
+
+		const unsigned int* triangle = &indices[best_triangle * 3];
+		optimized_indices.insert(optimized_indices.end(), triangle, triangle + 3);
+
+		new_cache.clear();
+		for (size_t corner = 0; corner < 3; corner++)
+		{
+			unsigned int vertex = triangle[corner];
+
+			// one triangle less to draw with this vertex
+			unsigned int* begin = &vertex_triangles[triangle_offsets[vertex]];
+			unsigned int* end	= begin + remaining_triangles[vertex];
+			std::iter_swap(std::find(begin, end, best_triangle), end - 1);
+			remaining_triangles[vertex]--;
+
+			// degenerate triangles use a vertex more than once
+			if (std::find(new_cache.begin(), new_cache.end(), vertex) == new_cache.end())
+			{
+				new_cache.push_back(vertex);
+			}
+		}
+
+		for (unsigned int vertex : cache)
+		{
+			if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2])
+			{
+				new_cache.push_back(vertex);
+			}
+		}
+
+		// new scores for every vertex that moved, and for the triangles still to draw with them
+		for (size_t i = 0; i < new_cache.size(); i++)
+		{
+			unsigned int vertex = new_cache[i];
+
+			cache_positions[vertex] = i < static_cast<size_t>(LRU_CACHE_SIZE) ? static_cast<int>(i) : -1;
+
+			float score = GetVertexScore(cache_positions[vertex], remaining_triangles[vertex]);
+			float delta = score - vertex_scores[vertex];
+
+			vertex_scores[vertex] = score;
+
+			const unsigned int* begin = &vertex_triangles[triangle_offsets[vertex]];
+			for (const unsigned int* it = begin; it != begin + remaining_triangles[vertex]; it++)
+			{
+				triangle_scores[*it] += delta;
+			}
+		}
+
+		new_cache.resize(std::min<size_t>(new_cache.size(), LRU_CACHE_SIZE));
+		cache.swap(new_cache);
+
+		// the next triangle is one of the cached vertices
+		best_triangle	 = INVALID_INDEX;
+		float best_score = -std::numeric_limits<float>::max();
+		for (unsigned int vertex : cache)
+		{
+			const unsigned int* begin = &vertex_triangles[triangle_offsets[vertex]];
+			for (const unsigned int* it = begin; it != begin + remaining_triangles[vertex]; it++)
+			{
+				if (triangle_scores[*it] > best_score)
+				{
+					best_score	  = triangle_scores[*it];
+					best_triangle = *it;
+				}
+			}
+		}
+	}
+
+	indices.swap(optimized_indices);
+}
+
+void OptimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<Vertex>& vertices, float threshold)
+{
+	size_t triangle_count = indices.size() / 3;
+	if (triangle_count == 0)
+	{
+		return;
+	}
+
+	struct Cluster
+	{
+			size_t	  begin; // first triangle
+			size_t	  end;
+			glm::vec3 centroid;
+			glm::vec3 normal;
+			float	  area;
+			float	  sort_key;
+	};
+
+	FifoCache cache { vertices.size() };
+
+	// a triangle missing all of its vertices starts over in the cache anyway, nothing is lost cutting there
+	std::vector<size_t> hard_boundaries;
+	for (size_t triangle = 0; triangle < triangle_count; triangle++)
+	{
+		const unsigned int* corners = &indices[triangle * 3];
+
+		size_t misses = cache.Miss(corners[0]) + cache.Miss(corners[1]) + cache.Miss(corners[2]);
+		if (triangle == 0 || misses == 3)
+		{
+			hard_boundaries.push_back(triangle);
+		}
+	}
+
+	hard_boundaries.push_back(triangle_count);
+
+	// in between, a cluster ends as soon as it uses the cache about as well as the whole part does
+	// each one is measured from an empty cache, once sorted it may be drawn after anything
+	std::vector<Cluster> clusters;
+	for (size_t part = 0; part + 1 < hard_boundaries.size(); part++)
+	{
+		size_t part_begin = hard_boundaries[part];
+		size_t part_end	  = hard_boundaries[part + 1];
+
+		cache.Flush();
+
+		size_t part_misses = 0;
+		for (size_t i = part_begin * 3; i < part_end * 3; i++)
+		{
+			part_misses += cache.Miss(indices[i]);
+		}
+
+		float part_acmr = static_cast<float>(part_misses) / static_cast<float>(part_end - part_begin);
+
+		cache.Flush();
+
+		size_t cluster_begin  = part_begin;
+		size_t cluster_misses = 0;
+		for (size_t triangle = part_begin; triangle < part_end; triangle++)
+		{
+			const unsigned int* corners = &indices[triangle * 3];
+			cluster_misses += cache.Miss(corners[0]) + cache.Miss(corners[1]) + cache.Miss(corners[2]);
+
+			size_t cluster_length = triangle + 1 - cluster_begin;
+			if (triangle + 1 == part_end
+				|| static_cast<float>(cluster_misses) <= threshold * part_acmr * static_cast<float>(cluster_length))
+			{
+				Cluster cluster {};
+				cluster.begin = cluster_begin;
+				cluster.end	  = triangle + 1;
+				clusters.push_back(cluster);
+
+				cluster_begin  = triangle + 1;
+				cluster_misses = 0;
+				cache.Flush();
+			}
+		}
+	}
+
+	for (Cluster& cluster : clusters)
+	{
+		for (size_t triangle = cluster.begin; triangle < cluster.end; triangle++)
+		{
+			const glm::vec3& a = vertices[indices[triangle * 3 + 0]].position;
+			const glm::vec3& b = vertices[indices[triangle * 3 + 1]].position;
+			const glm::vec3& c = vertices[indices[triangle * 3 + 2]].position;
+
+			// twice the area, only used as a weight
+			glm::vec3 normal = glm::cross(b - a, c - a);
+			float	  area	 = glm::length(normal);
+
+			cluster.centroid += (a + b + c) * (area / 3.0f);
+			cluster.normal	 += normal;
+			cluster.area	 += area;
+		}
+	}
+
+	glm::vec3 mesh_centroid { 0.0f };
+	float	  mesh_area = 0.0f;
+	for (const Cluster& cluster : clusters)
+	{
+		mesh_centroid += cluster.centroid;
+		mesh_area	  += cluster.area;
+	}
+
+	if (mesh_area > 0.0f)
+	{
+		mesh_centroid /= mesh_area;
+	}
+
+	// clusters far out and facing away from the center are the ones in front of the rest
+	for (Cluster& cluster : clusters)
+	{
+		float normal_length = glm::length(cluster.normal);
+		if (cluster.area > 0.0f && normal_length > 0.0f)
+		{
+			glm::vec3 centroid = cluster.centroid / cluster.area;
+			cluster.sort_key   = glm::dot(centroid - mesh_centroid, cluster.normal / normal_length);
+		}
+	}
+
+	std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& lhs, const Cluster& rhs) {
+		return lhs.sort_key > rhs.sort_key;
+	});
+
+	std::vector<unsigned int> sorted_indices;
+	sorted_indices.reserve(indices.size());
+
+	for (const Cluster& cluster : clusters)
+	{
+		sorted_indices.insert(
+			sorted_indices.end(), indices.begin() + cluster.begin * 3, indices.begin() + cluster.end * 3);
+	}
+
+	indices.swap(sorted_indices);
+}
+
+void OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+{
+	std::vector<unsigned int> remap(vertices.size(), INVALID_INDEX);
+
+	std::vector<Vertex> fetched_vertices;
+	fetched_vertices.reserve(vertices.size());
+
+	for (unsigned int& index : indices)
+	{
+		if (remap[index] == INVALID_INDEX)
+		{
+			remap[index] = static_cast<unsigned int>(fetched_vertices.size());
+			fetched_vertices.push_back(vertices[index]);
+		}
+
+		index = remap[index];
+	}
+
+	for (size_t vertex = 0; vertex < vertices.size(); vertex++)
+	{
+		if (remap[vertex] == INVALID_INDEX)
+		{
+			fetched_vertices.push_back(vertices[vertex]);
+		}
+	}
+
+	vertices.swap(fetched_vertices);
+}
+
+MeshOptimizationStats OptimizeMesh(MeshData& mesh, MeshOptimization optimization)
+{
+	MeshOptimizationStats stats;
+	stats.acmr_before = ComputeACMR(mesh.indices, mesh.vertices.size());
+
+	if (optimization != MeshOptimization::NONE)
+	{
+		OptimizeVertexCache(mesh.indices, mesh.vertices.size());
+
+		if (optimization == MeshOptimization::VERTEX_CACHE_AND_OVERDRAW)
+		{
+			OptimizeOverdraw(mesh.indices, mesh.vertices, OVERDRAW_THRESHOLD);
+		}
+
+		// last, it renames the vertices the other passes refer to
+		OptimizeVertexFetch(mesh.vertices, mesh.indices);
+	}
+
+	stats.acmr_after = ComputeACMR(mesh.indices, mesh.vertices.size());
+	return stats;
+}
\ No newline at end of file
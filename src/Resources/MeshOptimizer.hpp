@@ -0,0 +1,40 @@
+#ifndef MESHOPTIMIZER_HPP
+#define MESHOPTIMIZER_HPP
+
+#include "MeshLoader.hpp"
+#include <cstdint>
+
+// reorders the triangles and vertices of a mesh for the GPU, what is drawn stays the same
+enum class MeshOptimization : uint32_t
+{
+	NONE,
+
+	// triangles for the post-transform cache, then vertices in the order they are fetched
+	VERTEX_CACHE,
+
+	// the same, with clusters of triangles facing outwards drawn first
+	VERTEX_CACHE_AND_OVERDRAW
+};
+
+// average cache misses per triangle with a FIFO post-transform cache, between 0.5 (ideal) and 3
+float ComputeACMR(const std::vector<unsigned int>& indices, size_t vertex_count);
+
+// Tom Forsyth's linear-speed vertex cache optimization
+void OptimizeVertexCache(std::vector<unsigned int>& indices, size_t vertex_count);
+
+// splits the triangles where the cache starts over anyway and sorts those clusters front to back from the outside
+// threshold: how much worse than the whole mesh the ACMR of a cluster may get, 1.05 gives up 5%
+void OptimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<Vertex>& vertices, float threshold);
+
+// vertices in the order the indices first use them, the unused ones go last
+void OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+
+struct MeshOptimizationStats
+{
+		float acmr_before;
+		float acmr_after;
+};
+
+MeshOptimizationStats OptimizeMesh(MeshData& mesh, MeshOptimization optimization);
+
+#endif
\ No newline at end of file
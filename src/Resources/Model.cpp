@@ -1,268 +1,80 @@
 #include "Model.hpp"
-
+#include <Memory/MemoryTracker.hpp>
+#include <Utils/JSONUtils.hpp>
 #include <filesystem>
-#include <iostream>
-
-#include "Vertex.hpp"
-
-#define TINYOBJLOADER_IMPLEMENTATION
-#include <tiny_obj_loader.h>
 
 using namespace gl;
 
-void LoadModel(const std::string& filepath, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+MeshView Model::LoadData::GetView() const
 {
-	tinyobj::ObjReaderConfig reader_config;
-	reader_config.mtl_search_path = "./"; // path to material files
-	reader_config.vertex_color	  = true;
-
-	reader_config.triangulate = true;
-	constexpr size_t fv		  = 3;
-
-	// needs to import earcut into the project!
-	//reader_config.triangulation_method = "earcut";
+	return cooked.IsOpen() ? cooked.GetView() : GetMeshView(mesh);
+}
 
-	tinyobj::ObjReader reader;
+void Model::Decode(const std::string& filepath, LoadData& data)
+{
+	std::string		 mesh_filepath = filepath;
+	MeshOptimization optimization  = MeshOptimization::NONE;
 
-	if (!reader.ParseFromFile(filepath, reader_config))
+	if (std::filesystem::path { filepath }.extension() == ".json")
 	{
-		if (!reader.Error().empty())
+		nlohmann::json model_json = LoadJSONFromFile(filepath);
+
+		mesh_filepath = model_json.value(MESH_JSON_KEY, std::string {});
+		if (model_json.value(VERTEX_FORMAT_JSON_KEY, std::string {}) == PACKED_VERTEX_FORMAT)
 		{
-			std::cerr << "TinyObjReader: " << reader.Error();
+			data.format = VertexFormat::PACKED;
 		}
 
-		return;
+		std::string optimization_name = model_json.value(OPTIMIZATION_JSON_KEY, std::string {});
+		if (optimization_name == VERTEX_CACHE_OPTIMIZATION)
+		{
+			optimization = MeshOptimization::VERTEX_CACHE;
+		}
+		else if (optimization_name == OVERDRAW_OPTIMIZATION)
+		{
+			optimization = MeshOptimization::VERTEX_CACHE_AND_OVERDRAW;
+		}
 	}
 
-	if (!reader.Warning().empty())
+	if (mesh_filepath == CUBE_PRIMITIVE)
 	{
-		std::cout << "TinyObjReader: " << reader.Warning();
+		CreateCube(data.mesh.vertices, data.mesh.indices);
 	}
-
-	const tinyobj::attrib_t&				attrib	  = reader.GetAttrib();
-	const std::vector<tinyobj::shape_t>&	shapes	  = reader.GetShapes();
-	const std::vector<tinyobj::material_t>& materials = reader.GetMaterials();
-
-	size_t indexCount = 0;
-	for (const tinyobj::shape_t& shape : shapes)
+	else if (mesh_filepath == QUAD_PRIMITIVE)
 	{
-		indexCount += shape.mesh.indices.size();
+		CreateQuad(data.mesh.vertices, data.mesh.indices);
 	}
-
-	vertices.reserve(attrib.vertices.size() / fv);
-	indices.reserve(indexCount);
-
-	std::map<std::tuple<int, int, int>, unsigned int> unique_vertices;
-
-	// loop over shapes
-	size_t shapes_size = shapes.size();
-	for (size_t s = 0; s < shapes_size; s++)
+	else if (LoadCookedMesh(mesh_filepath, data.cooked, data.mesh, optimization) == false && data.mesh.vertices.empty())
 	{
-		// loop over faces(polygon)
-		size_t index_offset		 = 0;
-		size_t num_face_vertices = shapes[s].mesh.num_face_vertices.size();
-		for (size_t f = 0; f < num_face_vertices; f++)
-		{
-			// loop over vertices in the face
-			//size_t fv = static_cast<size_t>(shapes[s].mesh.num_face_vertices[f]);
-			for (size_t v = 0; v < fv; v++)
-			{
-				// access to vertex
-				tinyobj::index_t idx = shapes[s].mesh.indices[index_offset + v];
-
-				std::tuple<int, int, int> key = std::make_tuple(idx.vertex_index, idx.normal_index, idx.texcoord_index);
-
-				if (unique_vertices.find(key) != unique_vertices.end())
-				{
-					indices.push_back(unique_vertices[key]);
-					continue;
-				}
-
-				size_t current_index = unique_vertices.size();
-				unique_vertices[key] = static_cast<unsigned int>(current_index);
-				indices.push_back(unique_vertices[key]);
-
-				Vertex vertex;
-
-				tinyobj::real_t vx = attrib.vertices[3 * size_t(idx.vertex_index) + 0];
-				tinyobj::real_t vy = attrib.vertices[3 * size_t(idx.vertex_index) + 1];
-				tinyobj::real_t vz = attrib.vertices[3 * size_t(idx.vertex_index) + 2];
-
-				vertex.position = glm::vec3 { vx, vy, vz };
-
-				// check if `normal_index` is zero or positive. negative = no normal data
-				if (idx.normal_index >= 0)
-				{
-					tinyobj::real_t nx = attrib.normals[3 * size_t(idx.normal_index) + 0];
-					tinyobj::real_t ny = attrib.normals[3 * size_t(idx.normal_index) + 1];
-					tinyobj::real_t nz = attrib.normals[3 * size_t(idx.normal_index) + 2];
-
-					vertex.normal = glm::vec3 { nx, ny, nz };
-				}
-
-				// check if `texcoord_index` is zero or positive. negative = no texcoord data
-				if (idx.texcoord_index >= 0)
-				{
-					tinyobj::real_t tx = attrib.texcoords[2 * size_t(idx.texcoord_index) + 0];
-					tinyobj::real_t ty = attrib.texcoords[2 * size_t(idx.texcoord_index) + 1];
-
-					vertex.textureCoordinates = glm::vec2 { tx, ty };
-				}
-
-				// vertex colors
-				// there should always be color, even if default
-				tinyobj::real_t red	  = attrib.colors[3 * size_t(idx.vertex_index) + 0];
-				tinyobj::real_t green = attrib.colors[3 * size_t(idx.vertex_index) + 1];
-				tinyobj::real_t blue  = attrib.colors[3 * size_t(idx.vertex_index) + 2];
-
-				vertex.color = glm::vec3 { red, green, blue };
-
-				vertices.push_back(vertex);
-			}
-
-			index_offset += fv;
+		// neither the file nor a cooked version of it
+		CreateCube(data.mesh.vertices, data.mesh.indices);
+	}
 
-			// per-face material
-			//shapes[s].mesh.material_ids[f];
-		}
+	if (data.format == VertexFormat::PACKED)
+	{
+		PackVertices(data.GetView(), data.packedVertices);
 	}
 }
 
-void CreateCube(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+Model::Model(const std::string& filepath)
 {
-	constexpr glm::vec3 white { 1.0f, 1.0f, 1.0f };
-
-	constexpr glm::vec3 positions[] {
-		{ -0.5f, 0.5f,  0.5f	}, // 0 - left top near
-		{ -0.5f, -0.5f, 0.5f	 }, // 1 - left bottom near
-		{ 0.5f,	-0.5f, 0.5f	}, // 2 - right bottom near
-		{ 0.5f,	0.5f,  0.5f  }, // 3 - right top near
-		{ 0.5f,	0.5f,  -0.5f }, // 4 - right top far
-		{ 0.5f,	-0.5f, -0.5f }, // 5 - right bottom far
-		{ -0.5f, -0.5f, -0.5f }, // 6 - left bottom far
-		{ -0.5f, 0.5f,  -0.5f }, // 7 - left top far
-	};
-
-	constexpr glm::vec2 uvs[] {
-		{ 0.0f, 1.0f }, // 0 - top-left
-		{ 0.0f, 0.0f }, // 1 - bottom-left
-		{ 1.0f, 0.0f }, // 2 - bottom-right
-		{ 1.0f, 1.0f }, // 3 - top-right
-	};
-
-	constexpr glm::vec3 normals[] {
-		{ 0.0f,	1.0f,  0.0f  }, // 0 - top
-		{ 0.0f,	-1.0f, 0.0f	}, // 1 - bottom
-		{ -1.0f, 0.0f,  0.0f	}, // 2 - left
-		{ 1.0f,	0.0f,  0.0f  }, // 3 - right
-		{ 0.0f,	0.0f,  1.0f  }, // 4 - inward
-		{ 0.0f,	0.0f,  -1.0f }, // 5 - outward
-	};
-
-	// position, uv, normal
-	constexpr std::tuple<int, int, int> index_tuples[] {
-		{ 0, 0, 5 },
-		 { 1, 1, 5 },
-		  { 2, 2, 5 },
-		   { 0, 0, 5 },
-		{ 2, 2, 5 },
-		 { 3, 3, 5 },
-
-		{ 3, 0, 3 },
-		 { 2, 1, 3 },
-		  { 5, 2, 3 },
-		   { 3, 0, 3 },
-		{ 5, 2, 3 },
-		 { 4, 3, 3 },
-
-		{ 4, 0, 4 },
-		 { 5, 1, 4 },
-		  { 6, 2, 4 },
-		   { 4, 0, 4 },
-		{ 6, 2, 4 },
-		 { 7, 3, 4 },
-
-		{ 7, 0, 2 },
-		 { 6, 1, 2 },
-		  { 1, 2, 2 },
-		   { 7, 0, 2 },
-		{ 1, 2, 2 },
-		 { 0, 3, 2 },
-
-		{ 7, 0, 0 },
-		 { 0, 1, 0 },
-		  { 3, 2, 0 },
-		   { 7, 0, 0 },
-		{ 3, 2, 0 },
-		 { 4, 3, 0 },
-
-		{ 1, 0, 1 },
-		 { 6, 1, 1 },
-		  { 5, 2, 1 },
-		   { 1, 0, 1 },
-		{ 5, 2, 1 },
-		 { 2, 3, 1 },
-	};
-
-	std::map<std::tuple<int, int, int>, int> unique_indices;
-
-	for (const std::tuple<int, int, int>& index_tuple : index_tuples)
-	{
-		if (unique_indices.find(index_tuple) != unique_indices.end())
-		{
-			indices.push_back(unique_indices[index_tuple]);
-			continue;
-		}
+	LoadData data;
+	Decode(filepath, data);
 
-		size_t current_size			= unique_indices.size();
-		unique_indices[index_tuple] = current_size;
-		indices.push_back(unique_indices[index_tuple]);
-
-		vertices.push_back(Vertex {
-			positions[std::get<0>(index_tuple)],
-			white,
-			uvs[std::get<1>(index_tuple)],
-			normals[std::get<2>(index_tuple)],
-		});
-	}
+	Upload(data.GetView(), data.format, data.packedVertices);
 }
 
-void CreateQuad(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+Model::Model(const std::string&, LoadData&& data)
 {
-	vertices = {
-		{ { -0.5f, 0.5f, 0.0f },	 { 1.0f, 1.0f, 1.0f }, { 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f } },
-		{ { -0.5f, -0.5f, 0.0f }, { 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } },
-		{ { 0.5f, -0.5f, 0.0f },	 { 1.0f, 1.0f, 1.0f }, { 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } },
-		{ { 0.5f, 0.5f, 0.0f },	{ 1.0f, 1.0f, 1.0f }, { 1.0f, 1.0f }, { 0.0f, 0.0f, 1.0f } },
-	};
-
-	indices = { 0, 1, 2, 0, 2, 3 };
+	Upload(data.GetView(), data.format, data.packedVertices);
 }
 
-Model::Model(const std::string& filepath)
+void Model::Upload(const MeshView& mesh, VertexFormat format, const std::vector<PackedVertex>& packed_vertices)
 {
-	std::vector<Vertex> vertices;
-	std::vector<unsigned int>	indices;
-
-	if (filepath == CUBE_PRIMITIVE)
-	{
-		CreateCube(vertices, indices);
-	}
-	else if (filepath == QUAD_PRIMITIVE)
-	{
-		CreateQuad(vertices, indices);
-	}
-	else if (std::filesystem::exists(std::filesystem::path { filepath }))
-	{
-		LoadModel(filepath, vertices, indices);
-	}
-	else
-	{
-		CreateCube(vertices, indices);
-	}
-
-	vertexCount = vertices.size();
-	indexCount	= indices.size();
+	vertexCount = static_cast<int>(mesh.vertex_count);
+	indexCount	= static_cast<int>(mesh.index_count);
+	boundsMin	= mesh.bounds_min;
+	boundsMax	= mesh.bounds_max;
 
 	// generate handlers
 	glGenVertexArrays(1, &vao);
@@ -274,12 +86,42 @@ Model::Model(const std::string& filepath)
 
 	// EBO
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices[0]) * indices.size(), indices.data(), GL_STATIC_DRAW);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * mesh.index_count, mesh.indices, GL_STATIC_DRAW);
 
 	// VBO
 	glBindBuffer(GL_ARRAY_BUFFER, vbo);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices[0]) * vertices.size(), vertices.data(), GL_STATIC_DRAW);
 
+	size_t vertex_size = 0;
+	if (format == VertexFormat::PACKED)
+	{
+		vertex_size = sizeof(PackedVertex);
+		glBufferData(GL_ARRAY_BUFFER, vertex_size * packed_vertices.size(), packed_vertices.data(), GL_STATIC_DRAW);
+
+		SetPackedAttributes();
+
+		positionOffset = mesh.bounds_min;
+		positionScale  = mesh.bounds_max - mesh.bounds_min;
+	}
+	else
+	{
+		vertex_size = sizeof(Vertex);
+		glBufferData(GL_ARRAY_BUFFER, vertex_size * mesh.vertex_count, mesh.vertices, GL_STATIC_DRAW);
+
+		SetFloatAttributes();
+
+		positionOffset = glm::vec3 { 0.0f };
+		positionScale  = glm::vec3 { 1.0f };
+	}
+
+	// unbind
+	glBindVertexArray(0);
+
+	memorySize = vertex_size * mesh.vertex_count + sizeof(unsigned int) * mesh.index_count;
+	MemoryTracker::GetInstance().Allocate(MemoryTag::Models, memorySize);
+}
+
+void Model::SetFloatAttributes()
+{
 	glEnableVertexAttribArray(Vertex::POSITION);
 	glEnableVertexAttribArray(Vertex::NORMAL);
 	glEnableVertexAttribArray(Vertex::TEXTURE_COORDINATES);
@@ -298,15 +140,54 @@ Model::Model(const std::string& filepath)
 		reinterpret_cast<void*>(offsetof(Vertex, textureCoordinates)));
 	glVertexAttribPointer(
 		Vertex::COLOR, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void*>(offsetof(Vertex, color)));
+}
 
-	// unbind
-	glBindVertexArray(0);
+void Model::SetPackedAttributes()
+{
+	glEnableVertexAttribArray(Vertex::POSITION);
+	glEnableVertexAttribArray(Vertex::NORMAL);
+	glEnableVertexAttribArray(Vertex::TEXTURE_COORDINATES);
+	glEnableVertexAttribArray(Vertex::COLOR);
+
+	// normalized: the shaders read floats, the positions between 0 and 1 and the normals between -1 and 1
+	glVertexAttribPointer(
+		Vertex::POSITION,
+		3,
+		GL_UNSIGNED_SHORT,
+		GL_TRUE,
+		sizeof(PackedVertex),
+		reinterpret_cast<void*>(offsetof(PackedVertex, position)));
+	glVertexAttribPointer(
+		Vertex::NORMAL,
+		4,
+		GL_INT_2_10_10_10_REV,
+		GL_TRUE,
+		sizeof(PackedVertex),
+		reinterpret_cast<void*>(offsetof(PackedVertex, normal)));
+	glVertexAttribPointer(
+		Vertex::TEXTURE_COORDINATES,
+		2,
+		GL_HALF_FLOAT,
+		GL_FALSE,
+		sizeof(PackedVertex),
+		reinterpret_cast<void*>(offsetof(PackedVertex, textureCoordinates)));
+	glVertexAttribPointer(
+		Vertex::COLOR,
+		4,
+		GL_UNSIGNED_BYTE,
+		GL_TRUE,
+		sizeof(PackedVertex),
+		reinterpret_cast<void*>(offsetof(PackedVertex, color)));
 }
 
 void Model::Render()
 {
 	glBindVertexArray(vao);
 
+	// not part of the vertex array state, the attribute arrays are disabled so every vertex reads these
+	glVertexAttrib3fv(Vertex::POSITION_OFFSET, &positionOffset[0]);
+	glVertexAttrib3fv(Vertex::POSITION_SCALE, &positionScale[0]);
+
 	glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
 
 	glBindVertexArray(0);
@@ -317,4 +198,16 @@ Model::~Model()
 	glDeleteVertexArrays(1, &vao);
 	glDeleteBuffers(1, &vbo);
 	glDeleteBuffers(1, &ebo);
+
+	MemoryTracker::GetInstance().Free(MemoryTag::Models, memorySize);
+}
+
+glm::vec3 Model::GetBoundsMin() const
+{
+	return boundsMin;
+}
+
+glm::vec3 Model::GetBoundsMax() const
+{
+	return boundsMax;
 }
\ No newline at end of file
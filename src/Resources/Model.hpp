@@ -1,6 +1,8 @@
 #ifndef MODEL_HPP
 #define MODEL_HPP
 
+#include "CookedMesh.hpp"
+#include "MeshLoader.hpp"
 #include <glbinding/gl/gl.h>
 #include <string>
 
@@ -13,15 +15,64 @@ class Model
 		int vertexCount;
 		int indexCount;
 
+		// size of the vertex and index buffers, reported to the MemoryTracker
+		size_t memorySize;
+
+		glm::vec3 boundsMin;
+		glm::vec3 boundsMax;
+
+		// turns the stored positions back into model space, see Vertex::POSITION_OFFSET
+		glm::vec3 positionOffset;
+		glm::vec3 positionScale;
+
+		// packed_vertices are only read with VertexFormat::PACKED, the mesh provides the rest
+		void Upload(const MeshView& mesh, VertexFormat format, const std::vector<PackedVertex>& packed_vertices);
+		void SetFloatAttributes();
+		void SetPackedAttributes();
+
+		static constexpr char MESH_JSON_KEY[]			  = "mesh";
+		static constexpr char VERTEX_FORMAT_JSON_KEY[]	  = "vertex_format";
+		static constexpr char PACKED_VERTEX_FORMAT[]	  = "packed";
+		static constexpr char OPTIMIZATION_JSON_KEY[]	  = "optimization";
+		static constexpr char VERTEX_CACHE_OPTIMIZATION[] = "vertex_cache";
+		static constexpr char OVERDRAW_OPTIMIZATION[]	  = "overdraw";
+
 	public:
 		static constexpr char QUAD_PRIMITIVE[] = "QUAD_PRIMITIVE";
 		static constexpr char CUBE_PRIMITIVE[] = "CUBE_PRIMITIVE";
 
+		// shown while the model is loaded asynchronously, see ResourceManager::GetResourceAsync()
+		static constexpr const char* FALLBACK_RESOURCE = CUBE_PRIMITIVE;
+
+		// mesh files are read from their cooked version (see CookedMesh), mapped,
+		// the primitives and the meshes that could not be cooked are kept in memory
+		struct LoadData
+		{
+				CookedMesh cooked;
+				MeshData   mesh;
+
+				// packed vertices are built here, on the loading thread
+				VertexFormat			  format = VertexFormat::FLOAT;
+				std::vector<PackedVertex> packedVertices;
+
+				MeshView GetView() const;
+		};
+
+		// filepath is a mesh file, a primitive, or a json descriptor choosing how a mesh is stored:
+		// { "mesh": "data/meshes/level.obj", "vertex_format": "packed", "optimization": "overdraw" }
+		// optimization is "vertex_cache" or "overdraw" (see MeshOptimization), applied when the mesh is cooked
+		// the CPU side of the loading, safe to call from any thread
+		static void Decode(const std::string& filepath, LoadData& data);
+
 		Model(const std::string& filepath);
+		Model(const std::string& filepath, LoadData&& data);
 		~Model();
 
 		void Render();
 
+		glm::vec3 GetBoundsMin() const;
+		glm::vec3 GetBoundsMax() const;
+
 		// avoid unintended copying
 		Model(const Model&)			   = delete;
 		Model& operator=(const Model&) = delete;
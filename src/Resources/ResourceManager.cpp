@@ -1,4 +1,6 @@
 #include "ResourceManager.hpp"
+#include <Profiling/Profiler.hpp>
+#include <thread>
 
 void ResourceManager::DeleteResources()
 {
@@ -7,5 +9,56 @@ void ResourceManager::DeleteResources()
 
 void ResourceManager::Shutdown()
 {
+	// the workers push their results here, nothing may be left running once it is gone
+	while (decodingCount.load() > 0)
+	{
+		std::this_thread::yield();
+	}
+
 	DeleteResources();
+
+	// decoded, but never finalized
+	std::lock_guard<std::mutex> lock(pendingMutex);
+	loadingCount -= pendingFinalizations.size();
+	pendingFinalizations.clear();
+}
+
+void ResourceManager::Update()
+{
+	PROFILE_ZONE("ResourceManager");
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+	// at least one per frame, so that loading always makes progress
+	do
+	{
+		std::function<void()> finalize;
+		{
+			std::lock_guard<std::mutex> lock(pendingMutex);
+			if (pendingFinalizations.empty())
+			{
+				return;
+			}
+
+			finalize = std::move(pendingFinalizations.front());
+			pendingFinalizations.pop_front();
+		}
+
+		finalize();
+	} while (std::chrono::steady_clock::now() - begin < finalizeBudget);
+}
+
+void ResourceManager::SetFinalizeBudget(float milliseconds)
+{
+	finalizeBudget = std::chrono::duration<float, std::milli> { milliseconds };
+}
+
+float ResourceManager::GetFinalizeBudget() const
+{
+	return finalizeBudget.count();
+}
+
+size_t ResourceManager::GetLoadingCount() const
+{
+	return loadingCount;
 }
\ No newline at end of file
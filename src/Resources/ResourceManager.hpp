@@ -2,14 +2,33 @@
 #define RESOURCE_MANAGER_HPP
 
 #include <Utils/Singleton.hpp>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <typeindex>
 #include <unordered_map>
+#include <vector>
 
 template <typename T>
 class Resource;
 
+// resources that can be loaded by ResourceManager::GetResourceAsync() declare
+//     using LoadData = ...;                                  // what the worker hands to the main thread
+//     static void Decode(const std::string&, LoadData&);     // file reading and decoding, on a worker
+//     T(const std::string&, LoadData&&);                     // GPU objects, on the main thread
+//     static constexpr const char* FALLBACK_RESOURCE = ...;  // used in its place until it is ready
+template <typename T>
+concept AsyncLoadable = requires(const std::string& filepath, typename T::LoadData& data) {
+	T::Decode(filepath, data);
+	{ T::FALLBACK_RESOURCE } -> std::convertible_to<const char*>;
+} && std::constructible_from<T, const std::string&, typename T::LoadData&&>;
+
 class ResourceManager : public Singleton<ResourceManager>
 {
 		// ugly, but otherwise Resource cannot
@@ -22,12 +41,19 @@ class ResourceManager : public Singleton<ResourceManager>
 		{
 				static inline int ID_generator = 0;
 
-				T			rawResource;
-				std::string filePath;
-				int			id;
+				// empty while an asynchronous load is in flight
+				std::optional<T> rawResource;
+				std::string		 filePath;
+				int				 id;
 
+				// the asynchronous load could not decode the file, the fallback stays in its place
+				bool failed = false;
+
+				// loads right away
 				InternalResource(const std::string& filepath);
-				~InternalResource();
+
+				// filled in later by the ResourceManager, see GetResourceAsync()
+				InternalResource(const std::string& filepath, std::nullopt_t);
 		};
 
 		struct IResourceContainer
@@ -42,6 +68,7 @@ class ResourceManager : public Singleton<ResourceManager>
 
 			public:
 				std::weak_ptr<InternalResource<T>> operator[](const std::string& key);
+				std::weak_ptr<InternalResource<T>> emplace_loading(const std::string& key);
 				bool							   contains(const std::string& key) const;
 
 				void   erase(const std::string& key);
@@ -59,10 +86,41 @@ class ResourceManager : public Singleton<ResourceManager>
 		template <typename T>
 		ResourceContainer<T>& GetContainer();
 
+		// decoded by a worker, waiting for the main thread to create the GPU objects
+		std::mutex						  pendingMutex;
+		std::deque<std::function<void()>> pendingFinalizations;
+
+		// requested asynchronously and not finalized yet
+		std::atomic<size_t> loadingCount { 0 };
+
+		// still on a worker, Shutdown() waits for them
+		std::atomic<size_t> decodingCount { 0 };
+
+		std::chrono::duration<float, std::milli> finalizeBudget { DEFAULT_FINALIZE_BUDGET_MS };
+
 	public:
+		static constexpr float DEFAULT_FINALIZE_BUDGET_MS = 2.0f;
+
 		template <typename T>
 		Resource<T> GetResource(const std::string& name);
 
+		// returns right away, the resource reports IsLoading() and stands in with T::FALLBACK_RESOURCE
+		// until Update() has finalized it
+		template <AsyncLoadable T>
+		Resource<T> GetResourceAsync(const std::string& name);
+
+		// what Resource<T> shows while the real one is loading
+		template <AsyncLoadable T>
+		T* GetFallback();
+
+		// finalizes the decoded resources, as many as fit in the budget (at least one), on the main thread
+		void Update();
+
+		void  SetFinalizeBudget(float milliseconds);
+		float GetFinalizeBudget() const;
+
+		size_t GetLoadingCount() const;
+
 		template <typename T>
 		bool IsResourceLoaded(const std::string& name);
 
@@ -70,6 +128,8 @@ class ResourceManager : public Singleton<ResourceManager>
 		void DeleteResources();
 
 		void DeleteResources();
+
+		// waits for the decodes in flight, to be called before the JobSystem shuts down
 		void Shutdown();
 };
 
@@ -89,9 +149,13 @@ class Resource
 		Resource& operator=(const Resource& other) = default;
 
 		void Load(const std::string& name);
+		void LoadAsync(const std::string& name);
 
+		// the fallback resource while loading, or if loading failed
 		T*	 operator->();
 		bool IsValid() const;
+		bool IsLoading() const;
+		bool HasFailed() const;
 };
 
 #include "ResourceManager.inl"
@@ -1,20 +1,21 @@
 #include "ResourceManager.hpp"
 
-#include <stdexcept>
+#include <Memory/TrackedAllocator.hpp>
+#include <Profiling/Profiler.hpp>
+#include <Utils/JobSystem.hpp>
 #include <iostream>
+#include <stdexcept>
 
 template <typename T>
 ResourceManager::InternalResource<T>::InternalResource(const std::string& filepath)
-	: rawResource { filepath }
-	, filePath { filepath }
-	, id { ID_generator++ } {
-		std::cout << "Constructing object of type " << typeid(T).name() << " with id " << id << std::endl;
-	};
+	: rawResource { std::in_place, filepath }, filePath { filepath }, id { ID_generator++ }
+{
+}
 
 template <typename T>
-ResourceManager::InternalResource<T>::~InternalResource()
+ResourceManager::InternalResource<T>::InternalResource(const std::string& filepath, std::nullopt_t)
+	: rawResource {}, filePath { filepath }, id { ID_generator++ }
 {
-	std::cout << "Destructing object of type " << typeid(T).name() << " with id " << id << std::endl;
 }
 
 template <typename T>
@@ -24,13 +25,25 @@ ResourceManager::ResourceContainer<T>::operator[](const std::string& key)
 	typename std::unordered_map<std::string, std::shared_ptr<InternalResource<T>>>::iterator it = container.find(key);
 	if (it == container.end())
 	{
-		container[key] = std::make_shared<InternalResource<T>>(key);
+		// the resource and its control block, the memory it owns is reported by the resource itself
+		container[key] = std::allocate_shared<InternalResource<T>>(
+			TrackedAllocator<InternalResource<T>, MemoryTag::Resources> {}, key);
 		return std::weak_ptr<InternalResource<T>>(container[key]);
 	}
 
 	return std::weak_ptr<InternalResource<T>>(it->second);
 }
 
+template <typename T>
+std::weak_ptr<ResourceManager::InternalResource<T>>
+ResourceManager::ResourceContainer<T>::emplace_loading(const std::string& key)
+{
+	container[key] = std::allocate_shared<InternalResource<T>>(
+		TrackedAllocator<InternalResource<T>, MemoryTag::Resources> {}, key, std::nullopt);
+
+	return std::weak_ptr<InternalResource<T>>(container[key]);
+}
+
 template <typename T>
 bool ResourceManager::ResourceContainer<T>::contains(const std::string& key) const
 {
@@ -119,6 +132,86 @@ Resource<T> ResourceManager::GetResource(const std::string& name)
 	return Resource<T>(container[name]);
 }
 
+template <AsyncLoadable T>
+Resource<T> ResourceManager::GetResourceAsync(const std::string& name)
+{
+	ResourceContainer<T>& container = GetContainer<T>();
+
+	// already loaded, or on its way
+	if (container.contains(name))
+	{
+		return Resource<T>(container[name]);
+	}
+
+	std::weak_ptr<InternalResource<T>> reference = container.emplace_loading(name);
+	loadingCount++;
+	decodingCount++;
+
+	JobSystem::GetInstance().Submit([this, reference, name]() {
+		PROFILE_ZONE("Decode resource");
+
+		// std::function needs something copyable to carry it
+		std::shared_ptr<typename T::LoadData> data = std::make_shared<typename T::LoadData>();
+
+		// an exception would end the worker thread, and the program with it
+		bool		decoded = true;
+		std::string error;
+		try
+		{
+			T::Decode(name, *data);
+		}
+		catch (const std::exception& e)
+		{
+			decoded = false;
+			error	= e.what();
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(pendingMutex);
+			pendingFinalizations.push_back([this, reference, data, decoded, error]() {
+				// the resource may have been deleted in the meantime
+				std::shared_ptr<InternalResource<T>> resource = reference.lock();
+
+				if (decoded == false)
+				{
+					// reported from the main thread, the workers would interleave their output
+					std::cerr << "Could not load \"" << (resource != nullptr ? resource->filePath : std::string {})
+							  << "\": " << error << std::endl;
+
+					if (resource != nullptr)
+					{
+						resource->failed = true;
+					}
+				}
+				else if (resource != nullptr)
+				{
+					resource->rawResource.emplace(resource->filePath, std::move(*data));
+				}
+
+				loadingCount--;
+			});
+		}
+
+		decodingCount--;
+	});
+
+	return Resource<T>(reference);
+}
+
+template <AsyncLoadable T>
+T* ResourceManager::GetFallback()
+{
+	std::shared_ptr<InternalResource<T>> fallback = GetContainer<T>()[T::FALLBACK_RESOURCE].lock();
+
+	// someone asked for the fallback itself asynchronously, it cannot wait
+	if (fallback->rawResource.has_value() == false)
+	{
+		fallback->rawResource.emplace(fallback->filePath);
+	}
+
+	return &*fallback->rawResource;
+}
+
 template <typename T>
 bool ResourceManager::IsResourceLoaded(const std::string& name)
 {
@@ -158,6 +251,13 @@ void Resource<T>::Load(const std::string& name)
 	resourceReference		 = tempResource.resourceReference;
 }
 
+template <typename T>
+void Resource<T>::LoadAsync(const std::string& name)
+{
+	Resource<T> tempResource = ResourceManager::GetInstance().GetResourceAsync<T>(name);
+	resourceReference		 = tempResource.resourceReference;
+}
+
 template <typename T>
 T* Resource<T>::operator->()
 {
@@ -167,11 +267,35 @@ T* Resource<T>::operator->()
 		throw std::runtime_error("Resource is not available available.");
 	}
 
-	return &internalResourceReference->rawResource;
+	// only asynchronous loads can be in this state (still loading, or failed)
+	if (internalResourceReference->rawResource.has_value() == false)
+	{
+		if constexpr (AsyncLoadable<T>)
+		{
+			return ResourceManager::GetInstance().GetFallback<T>();
+		}
+	}
+
+	return &*internalResourceReference->rawResource;
 }
 
 template <typename T>
 bool Resource<T>::IsValid() const
 {
 	return resourceReference.lock() != nullptr;
+}
+
+template <typename T>
+bool Resource<T>::IsLoading() const
+{
+	std::shared_ptr<ResourceManager::InternalResource<T>> internalResourceReference = resourceReference.lock();
+	return internalResourceReference != nullptr && internalResourceReference->rawResource.has_value() == false
+		&& internalResourceReference->failed == false;
+}
+
+template <typename T>
+bool Resource<T>::HasFailed() const
+{
+	std::shared_ptr<ResourceManager::InternalResource<T>> internalResourceReference = resourceReference.lock();
+	return internalResourceReference != nullptr && internalResourceReference->failed;
 }
\ No newline at end of file
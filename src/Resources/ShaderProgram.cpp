@@ -93,13 +93,15 @@ std::string GetDummyShaderCode(gl::GLenum shader_type)
 		#version 460
 		
 		layout(location = 0) in vec3 position;
+		layout(location = 4) in vec3 position_offset;
+		layout(location = 5) in vec3 position_scale;
 
 		layout(location = 0) uniform mat4 viewproj;
 		layout(location = 1) uniform mat4 model;
 
 		void main()
 		{
-			gl_Position = viewproj * model * vec4(position, 1.0f);
+			gl_Position = viewproj * model * vec4(position_offset + position * position_scale, 1.0f);
 		}
 		)";
 	}
@@ -2,66 +2,63 @@
 
 #include <filesystem>
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
+#include <Memory/MemoryTracker.hpp>
 
 using namespace gl;
 
-uint8_t* GenerateDummyTexture(int width, int height)
+namespace
 {
-	int		 texture_size = width * height;
-	uint8_t* texture_data = new uint8_t[texture_size * 4];
-
-	for (int y = 0; y < height; y++)
+	// approximation of what the driver keeps for the given internal format
+	size_t GetBytesPerPixel(GLint internal_format)
 	{
-		for (int x = 0; x < width; x++)
+		switch (static_cast<GLenum>(internal_format))
 		{
-			uint8_t color = (x + y) % 2 == 0 ? 255 : 0;
-
-			texture_data[(y * width + x) * 4 + 0] = color;
-			texture_data[(y * width + x) * 4 + 1] = color;
-			texture_data[(y * width + x) * 4 + 2] = color;
-			texture_data[(y * width + x) * 4 + 3] = color;
+			case GL_RED:
+			case GL_R8: return 1;
+			case GL_RG:
+			case GL_RG8: return 2;
+			case GL_RGB:
+			case GL_RGB8: return 3;
+			case GL_RGBA16F: return 8;
+			case GL_RGBA32F: return 16;
+			default: return 4;
 		}
 	}
+} // namespace
 
-	return texture_data;
+void Texture::Decode(const std::string& filepath, ImageData& image)
+{
+	if (filepath == DUMMY_TEXTURE || std::filesystem::exists(std::filesystem::path { filepath }) == false
+		|| DecodeImage(filepath, image) == false)
+	{
+		GenerateDummyImage(DUMMY_TEXTURE_SIZE, image);
+	}
 }
 
 Texture::Texture(const std::string& filepath)
 {
-	TextureInfo texture_info;
-	uint8_t*	texture_data;
-
-	bool loaded_from_stb = false;
-
 	if (filepath == RENDER_TARGET)
 	{
 		// expects UploadTextureData() at some point
 		return;
-	} 
-	else if (std::filesystem::exists(std::filesystem::path { filepath }))
-	{
-		int comp;
-		texture_data = stbi_load(filepath.c_str(), &texture_info.size.x, &texture_info.size.y, &comp, 4);
-
-		if (texture_data)
-		{
-			loaded_from_stb = true;
-		}
-		else
-		{
-			texture_info.size = DUMMY_TEXTURE_SIZE;
-			texture_data	  = GenerateDummyTexture(texture_info.size.x, texture_info.size.y);
-		}
-	}
-	else
-	{
-		texture_info.size = DUMMY_TEXTURE_SIZE;
-		texture_data	  = GenerateDummyTexture(texture_info.size.x, texture_info.size.y);
 	}
 
-	texture_info.data			 = texture_data;
+	ImageData image;
+	Decode(filepath, image);
+
+	Upload(image);
+}
+
+Texture::Texture(const std::string&, ImageData&& image)
+{
+	Upload(image);
+}
+
+void Texture::Upload(const ImageData& image)
+{
+	TextureInfo texture_info;
+	texture_info.data			 = image.pixels.get();
+	texture_info.size			 = image.size;
 	texture_info.format			 = GL_RGBA;
 	texture_info.internal_format = static_cast<GLint>(GL_RGBA);
 	texture_info.data_type		 = GL_UNSIGNED_BYTE;
@@ -76,17 +73,6 @@ Texture::Texture(const std::string& filepath)
 		std::pair<GLenum, GLint> { GL_TEXTURE_MAG_FILTER, static_cast<GLint>(GL_NEAREST) });
 
 	UploadTextureData(texture_info);
-
-	// we could do this calling free()
-	// but just in case the stbi implementation changes
-	if (loaded_from_stb)
-	{
-		stbi_image_free(texture_data);
-	}
-	else
-	{
-		delete[] texture_data;
-	}
 }
 
 void Texture::UploadTextureData(const Texture::TextureInfo& info)
@@ -106,11 +92,24 @@ void Texture::UploadTextureData(const Texture::TextureInfo& info)
 
 	// unbind texture
 	glBindTexture(GL_TEXTURE_2D, 0);
+
+	if (memorySize != 0)
+	{
+		MemoryTracker::GetInstance().Free(MemoryTag::Textures, memorySize);
+	}
+
+	memorySize = static_cast<size_t>(info.size.x) * info.size.y * GetBytesPerPixel(info.internal_format);
+	MemoryTracker::GetInstance().Allocate(MemoryTag::Textures, memorySize);
 }
 
 Texture::~Texture()
 {
 	glDeleteTextures(1, &handle);
+
+	if (memorySize != 0)
+	{
+		MemoryTracker::GetInstance().Free(MemoryTag::Textures, memorySize);
+	}
 }
 
 void Texture::Bind()
@@ -1,16 +1,23 @@
 #ifndef TEXTURE_HPP
 #define TEXTURE_HPP
 
+#include "ImageLoader.hpp"
 #include <glbinding/gl/gl.h>
 #include <glm/glm.hpp>
 #include <string>
+#include <vector>
 
 class Texture
 {
 		gl::GLuint handle;
-		
+
+		// uploaded bytes, reported to the MemoryTracker
+		size_t memorySize = 0;
+
 		static constexpr glm::ivec2 DUMMY_TEXTURE_SIZE = glm::ivec2 { 16, 16 };
 
+		void Upload(const ImageData& image);
+
 	public:
 		struct TextureInfo
 		{
@@ -25,8 +32,19 @@ class Texture
 		};
 
 		static constexpr char RENDER_TARGET[] = "EMPTY_TEXTURE";
+		static constexpr char DUMMY_TEXTURE[] = "DUMMY_TEXTURE";
+
+		// shown while the texture is loaded asynchronously, see ResourceManager::GetResourceAsync()
+		static constexpr const char* FALLBACK_RESOURCE = DUMMY_TEXTURE;
+
+		using LoadData = ImageData;
+
+		// the CPU side of the loading, safe to call from any thread
+		// missing or broken files decode as a checkerboard
+		static void Decode(const std::string& filepath, ImageData& image);
 
 		Texture(const std::string& filepath);
+		Texture(const std::string& filepath, ImageData&& image);
 
 		~Texture();
 
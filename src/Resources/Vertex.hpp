@@ -1,8 +1,15 @@
 #ifndef VERTEX_HPP
 #define VERTEX_HPP
 
+#include <cstdint>
 #include <glm/glm.hpp>
 
+enum class VertexFormat
+{
+	FLOAT,
+	PACKED
+};
+
 struct Vertex
 {
 		enum AttributeLocations
@@ -10,7 +17,11 @@ struct Vertex
 			POSITION,
 			COLOR,
 			TEXTURE_COORDINATES,
-			NORMAL
+			NORMAL,
+
+			// constant per model, the shaders compute position_offset + position * position_scale
+			POSITION_OFFSET,
+			POSITION_SCALE
 		};
 
 		glm::vec3 position;
@@ -19,4 +30,13 @@ struct Vertex
 		glm::vec3 normal;
 };
 
+// 20 bytes instead of 44, built from Vertex by PackVertices()
+struct PackedVertex
+{
+		uint16_t position[4];			// unorm16 between the bounds of the mesh, the last one is padding
+		uint32_t color;					// rgba8
+		uint32_t textureCoordinates;	// two half floats, uvs may repeat outside [0, 1]
+		uint32_t normal;				// snorm 10:10:10:2
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,18 @@
+#include "VertexIndexMap.hpp"
+#include <bit>
+
+VertexIndexMap::VertexIndexMap(size_t max_keys)
+	: mSlots(std::bit_ceil(max_keys * 2 + 1), EMPTY), mMask { mSlots.size() - 1 }
+{
+	mKeys.reserve(max_keys);
+}
+
+size_t VertexIndexMap::GetSize() const
+{
+	return mKeys.size();
+}
+
+const std::vector<VertexIndexMap::Key>& VertexIndexMap::GetKeys() const
+{
+	return mKeys;
+}
\ No newline at end of file
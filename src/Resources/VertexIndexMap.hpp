@@ -0,0 +1,50 @@
+#ifndef VERTEXINDEXMAP_HPP
+#define VERTEXINDEXMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// attribute indices of a face corner -> index of the vertex built from them, used to share vertices between faces
+// open addressing with linear probing, sized once from the number of corners so it never grows nor rehashes
+class VertexIndexMap
+{
+	public:
+		struct Key
+		{
+				int position;
+				int normal;
+				int texture_coordinates;
+
+				bool operator==(const Key& other) const = default;
+		};
+
+	private:
+		static constexpr unsigned int EMPTY = ~0u;
+
+		// vertex indices, the keys are compared through mKeys
+		std::vector<unsigned int> mSlots;
+		size_t					  mMask;
+
+		// key of every vertex index handed out, in order
+		std::vector<Key> mKeys;
+
+		static size_t Hash(const Key& key);
+
+	public:
+		// room for that many keys, at most half of the slots are ever used
+		VertexIndexMap(size_t max_keys);
+
+		// a single probe sequence: the index already given to the key, or the next one (inserted tells which)
+		// indices are handed out in order, starting from 0
+		unsigned int FindOrInsert(const Key& key, bool& inserted);
+
+		size_t GetSize() const;
+
+		// the key of every index handed out, at that index
+		const std::vector<Key>& GetKeys() const;
+};
+
+#include "VertexIndexMap.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "VertexIndexMap.hpp"
+
+inline size_t VertexIndexMap::Hash(const Key& key)
+{
+	// the attribute indices are small and correlated, spread them over the whole word before masking
+	uint64_t hash = static_cast<uint32_t>(key.position) * 0x9E3779B97F4A7C15ull;
+	hash		 ^= static_cast<uint32_t>(key.normal) * 0xC2B2AE3D27D4EB4Full;
+	hash		 ^= static_cast<uint32_t>(key.texture_coordinates) * 0x165667B19E3779F9ull;
+	hash		 ^= hash >> 29;
+
+	return static_cast<size_t>(hash);
+}
+
+inline unsigned int VertexIndexMap::FindOrInsert(const Key& key, bool& inserted)
+{
+	for (size_t slot = Hash(key) & mMask;; slot = (slot + 1) & mMask)
+	{
+		unsigned int index = mSlots[slot];
+
+		if (index == EMPTY)
+		{
+			index		 = static_cast<unsigned int>(mKeys.size());
+			mSlots[slot] = index;
+			mKeys.push_back(key);
+
+			inserted = true;
+			return index;
+		}
+
+		if (mKeys[index] == key)
+		{
+			inserted = false;
+			return index;
+		}
+	}
+}
\ No newline at end of file
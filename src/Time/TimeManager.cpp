@@ -0,0 +1,102 @@
+#include "TimeManager.hpp"
+#include <algorithm>
+
+int TimeManager::Advance(float frame_delta_time)
+{
+	mFrameDeltaTime = std::max(frame_delta_time, 0.0f);
+	mAccumulator   += mFrameDeltaTime;
+
+	int steps = 0;
+	while (mAccumulator >= mFixedDeltaTime && steps < mMaxStepsPerFrame)
+	{
+		mAccumulator -= mFixedDeltaTime;
+		steps++;
+	}
+
+	// the simulation cannot keep up, slow it down rather than spending even longer on the next frame
+	if (mAccumulator >= mFixedDeltaTime)
+	{
+		int dropped = static_cast<int>(mAccumulator / mFixedDeltaTime);
+
+		mDroppedSteps += dropped;
+		mAccumulator  -= dropped * mFixedDeltaTime;
+	}
+
+	mStepCount		  += steps;
+	mInterpolationAlpha = std::clamp(mAccumulator / mFixedDeltaTime, 0.0f, 1.0f);
+
+	return steps;
+}
+
+void TimeManager::SetTickRate(float ticks_per_second)
+{
+	if (ticks_per_second <= 0.0f)
+	{
+		return;
+	}
+
+	// keep the same fraction of a step pending
+	mAccumulator	= mAccumulator / mFixedDeltaTime / ticks_per_second;
+	mTickRate		= ticks_per_second;
+	mFixedDeltaTime = 1.0f / ticks_per_second;
+}
+
+float TimeManager::GetTickRate() const
+{
+	return mTickRate;
+}
+
+void TimeManager::SetMaxStepsPerFrame(int steps)
+{
+	mMaxStepsPerFrame = std::max(steps, 1);
+}
+
+int TimeManager::GetMaxStepsPerFrame() const
+{
+	return mMaxStepsPerFrame;
+}
+
+float TimeManager::GetFixedDeltaTime() const
+{
+	return mFixedDeltaTime;
+}
+
+float TimeManager::GetFrameDeltaTime() const
+{
+	return mFrameDeltaTime;
+}
+
+float TimeManager::GetInterpolationAlpha() const
+{
+	return mInterpolationAlpha;
+}
+
+unsigned long long TimeManager::GetStepCount() const
+{
+	return mStepCount;
+}
+
+unsigned long long TimeManager::GetDroppedSteps() const
+{
+	return mDroppedSteps;
+}
+
+#include <imgui.h>
+
+void TimeManager::Edit()
+{
+	float tick_rate = mTickRate;
+	if (ImGui::DragFloat("Tick rate", &tick_rate, 1.0f, 1.0f, 240.0f))
+	{
+		SetTickRate(tick_rate);
+	}
+
+	int max_steps = mMaxStepsPerFrame;
+	if (ImGui::DragInt("Max steps per frame", &max_steps, 1.0f, 1, 20))
+	{
+		SetMaxStepsPerFrame(max_steps);
+	}
+
+	ImGui::Text("Steps: %llu (%llu dropped)", mStepCount, mDroppedSteps);
+	ImGui::Text("Interpolation: %.2f", mInterpolationAlpha);
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef TIMEMANAGER_HPP
+#define TIMEMANAGER_HPP
+
+#include <Utils/Singleton.hpp>
+
+// splits the variable frame time into fixed simulation steps
+// the remainder that does not fill a whole step is used to interpolate between the last two steps
+class TimeManager : public Singleton<TimeManager>
+{
+		float mTickRate			= DEFAULT_TICK_RATE;
+		float mFixedDeltaTime	= 1.0f / DEFAULT_TICK_RATE;
+		int	  mMaxStepsPerFrame = DEFAULT_MAX_STEPS_PER_FRAME;
+
+		// simulation time not consumed by any step yet
+		float mAccumulator = 0.0f;
+
+		float mFrameDeltaTime	  = 0.0f;
+		float mInterpolationAlpha = 0.0f;
+
+		// steps run since the beginning and steps thrown away by the catch-up limit
+		unsigned long long mStepCount	 = 0;
+		unsigned long long mDroppedSteps = 0;
+
+	public:
+		static constexpr float DEFAULT_TICK_RATE		   = 60.0f;
+		static constexpr int   DEFAULT_MAX_STEPS_PER_FRAME = 5;
+
+		// adds the time of the frame and returns how many fixed steps have to be simulated
+		// never more than the catch-up limit, the rest of the time is dropped instead of piling up
+		int Advance(float frame_delta_time);
+
+		void  SetTickRate(float ticks_per_second);
+		float GetTickRate() const;
+
+		void SetMaxStepsPerFrame(int steps);
+		int	 GetMaxStepsPerFrame() const;
+
+		// duration of a simulation step, in seconds
+		float GetFixedDeltaTime() const;
+
+		// real duration of the last frame, in seconds
+		float GetFrameDeltaTime() const;
+
+		// how far the frame is between the previous and the current step, in [0, 1)
+		float GetInterpolationAlpha() const;
+
+		unsigned long long GetStepCount() const;
+		unsigned long long GetDroppedSteps() const;
+
+		void Edit();
+};
+
+#endif
\ No newline at end of file
@@ -1,45 +1,308 @@
 #include "HierarchyManager.hpp"
 #include "TransformationComponent.hpp"
+#include "MatrixKernel.hpp"
 #include <GameObject/GameObject.hpp>
+#include <Profiling/Profiler.hpp>
+#include <Utils/JobSystem.hpp>
+#include <algorithm>
 #include <vector>
 
 void HierarchyManager::Shutdown()
 {
-	mRootTransformations.clear();
+	for (TransformationComponent* component : mComponents)
+	{
+		component->mIndex = INVALID_INDEX;
+	}
+
+	mComponents.clear();
+	mParentIndices.clear();
+	mSubtreeSizes.clear();
+	mLocalTransformations.clear();
+	mWorldTransformations.clear();
+	mWorldMatrices.clear();
+	mDirtyFlags.clear();
+	mDirtyDescendantFlags.clear();
+	mMotionFlags.clear();
+	mPreviousWorldTransformations.clear();
+	mInterpolatedMatrices.clear();
+
+	mDirtyRoots.clear();
+
+	mNeedsSorting		   = false;
+	mDeferredUpdates	   = false;
+	mNeedsDirtyPropagation = false;
+	mRecomputedCount	   = 0;
 }
 
-void UpdateHierarchyRecursive(GameObject* object)
+void HierarchyManager::SortHierarchy()
 {
-	if (object == nullptr)
+	PROFILE_ZONE("Sort hierarchy");
+
+	const int count = static_cast<int>(mComponents.size());
+
+	// parents as they are currently stored
+	std::vector<int> parents(count);
+	for (int i = 0; i < count; i++)
 	{
-		return;
+		TransformationComponent* parent = mComponents[i]->GetParentTransformation();
+		parents[i]						= parent != nullptr ? parent->mIndex : INVALID_INDEX;
 	}
 
-	TransformationComponent* component = object->GetComponent<TransformationComponent>();
-	if (component == nullptr)
+	// children of every transformation, stored contiguously (keeping their current relative order)
+	std::vector<int> first_child(count + 1, 0);
+	for (int i = 0; i < count; i++)
 	{
-		return;
+		if (parents[i] != INVALID_INDEX)
+		{
+			first_child[parents[i] + 1]++;
+		}
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		first_child[i + 1] += first_child[i];
+	}
+
+	std::vector<int> children(first_child[count]);
+	std::vector<int> child_cursor(first_child.begin(), first_child.end() - 1);
+	for (int i = 0; i < count; i++)
+	{
+		if (parents[i] != INVALID_INDEX)
+		{
+			children[child_cursor[parents[i]]++] = i;
+		}
+	}
+
+	// depth-first traversal starting from every root
+	std::vector<int> order;
+	order.reserve(count);
+
+	std::vector<int>  stack;
+	std::vector<bool> visited(count, false);
+	for (int root = 0; root < count; root++)
+	{
+		if (parents[root] != INVALID_INDEX)
+		{
+			continue;
+		}
+
+		stack.push_back(root);
+		while (stack.empty() == false)
+		{
+			int current = stack.back();
+			stack.pop_back();
+
+			visited[current] = true;
+			order.push_back(current);
+
+			// pushed in reverse so that children keep their relative order
+			for (int child = first_child[current + 1] - 1; child >= first_child[current]; child--)
+			{
+				stack.push_back(children[child]);
+			}
+		}
+	}
+
+	// transformations in a parenting cycle are never reached from a root, treat them as roots
+	for (int i = 0; i < count; i++)
+	{
+		if (visited[i] == false)
+		{
+			parents[i] = INVALID_INDEX;
+			order.push_back(i);
+		}
+	}
+
+	// move everything to its new position
+	std::vector<int> new_indices(count);
+	for (int i = 0; i < count; i++)
+	{
+		new_indices[order[i]] = i;
+	}
+
+	TransformArray<TransformationComponent*> sorted_components(count);
+	TransformArray<Transformation>			 sorted_local_transformations(count);
+	TransformArray<Transformation>			 sorted_world_transformations(count);
+	TransformArray<glm::mat4>				 sorted_world_matrices(count);
+	TransformArray<uint8_t>					 sorted_dirty_flags(count);
+	TransformArray<uint8_t>					 sorted_motion_flags(count);
+	TransformArray<Transformation>			 sorted_previous_world_transformations(count);
+	TransformArray<glm::mat4>				 sorted_interpolated_matrices(count);
+
+	mParentIndices.resize(count);
+	for (int i = 0; i < count; i++)
+	{
+		int old_index = order[i];
+
+		sorted_components[i]			= mComponents[old_index];
+		sorted_local_transformations[i] = mLocalTransformations[old_index];
+		sorted_world_transformations[i] = mWorldTransformations[old_index];
+		sorted_world_matrices[i]		= mWorldMatrices[old_index];
+		sorted_dirty_flags[i]			= mDirtyFlags[old_index];
+		sorted_motion_flags[i]			= mMotionFlags[old_index];
+
+		sorted_previous_world_transformations[i] = mPreviousWorldTransformations[old_index];
+		sorted_interpolated_matrices[i]			 = mInterpolatedMatrices[old_index];
+
+		mParentIndices[i] = parents[old_index] != INVALID_INDEX ? new_indices[parents[old_index]] : INVALID_INDEX;
+
+		sorted_components[i]->mIndex = i;
+	}
+
+	mComponents.swap(sorted_components);
+	mLocalTransformations.swap(sorted_local_transformations);
+	mWorldTransformations.swap(sorted_world_transformations);
+	mWorldMatrices.swap(sorted_world_matrices);
+	mDirtyFlags.swap(sorted_dirty_flags);
+	mMotionFlags.swap(sorted_motion_flags);
+	mPreviousWorldTransformations.swap(sorted_previous_world_transformations);
+	mInterpolatedMatrices.swap(sorted_interpolated_matrices);
+
+	// children are stored after their parents, so sizes can be accumulated backwards
+	mSubtreeSizes.assign(count, 1);
+	for (int i = count - 1; i >= 0; i--)
+	{
+		int parent = mParentIndices[i];
+		if (parent != INVALID_INDEX)
+		{
+			mSubtreeSizes[parent] += mSubtreeSizes[i];
+		}
+	}
+
+	mDirtyDescendantFlags.assign(count, 0);
+	PropagateDirtyFlags();
+
+	mNeedsSorting = false;
+}
+
+void HierarchyManager::PropagateDirtyFlags()
+{
+	// children are stored after their parents, so the flags can be accumulated backwards
+	for (int i = static_cast<int>(mComponents.size()) - 1; i >= 0; i--)
+	{
+		int parent = mParentIndices[i];
+		if (parent != INVALID_INDEX && (mDirtyFlags[i] || mDirtyDescendantFlags[i]))
+		{
+			mDirtyDescendantFlags[parent] = 1;
+		}
+	}
+
+	mNeedsDirtyPropagation = false;
+}
+
+void HierarchyManager::UpdateSubtree(int root)
+{
+	// parents always come first, so a single pass resolves the whole subtree
+	const int end = root + mSubtreeSizes[root];
+	for (int i = root; i < end; i++)
+	{
+		StorePreviousWorld(i);
+
+		int parent = mParentIndices[i];
+		if (parent != INVALID_INDEX)
+		{
+			mWorldTransformations[i] = mWorldTransformations[parent] * mLocalTransformations[i];
+		}
+		else
+		{
+			mWorldTransformations[i] = mLocalTransformations[i];
+		}
+
+		mDirtyFlags[i]			 = 0;
+		mDirtyDescendantFlags[i] = 0;
 	}
 
-	component->Update();
-	const std::vector<GameObject*>& children = object->GetChildren();
-	for (GameObject* child : children)
+	// the matrices of the whole range are built in a single batch
+	BuildWorldMatrices(&mWorldTransformations[root], &mWorldMatrices[root], end - root);
+}
+
+void HierarchyManager::StorePreviousWorld(int index)
+{
+	if (mMotionFlags[index] == STATIC)
 	{
-		UpdateHierarchyRecursive(child);
+		mPreviousWorldTransformations[index] = mWorldTransformations[index];
+		mMotionFlags[index]					 = MOVED;
+	}
+}
+
+void HierarchyManager::BeginStep()
+{
+	std::fill(mMotionFlags.begin(), mMotionFlags.end(), STATIC);
+}
+
+void HierarchyManager::Interpolate(float alpha)
+{
+	PROFILE_ZONE("Interpolate transformations");
+
+	const int count = static_cast<int>(mComponents.size());
+	for (int i = 0; i < count; i++)
+	{
+		if (mMotionFlags[i] == MOVED)
+		{
+			Transformation interpolated = mPreviousWorldTransformations[i].Interpolate(mWorldTransformations[i], alpha);
+			mInterpolatedMatrices[i]	= interpolated.GetMatrix();
+		}
 	}
 }
 
 void HierarchyManager::Update()
 {
-	for (TransformationComponent* component : mRootTransformations)
+	PROFILE_ZONE("HierarchyManager");
+
+	// sorting flags the ancestors as well
+	if (mNeedsSorting)
 	{
-		component->Update();
+		SortHierarchy();
+	}
+	else if (mNeedsDirtyPropagation)
+	{
+		PropagateDirtyFlags();
+	}
+
+	mRecomputedCount = 0;
+	mDirtyRoots.clear();
 
-		const std::vector<GameObject*>& children = component->GetOwner()->GetChildren();
-		for (GameObject* child : children)
+	const int count = static_cast<int>(mComponents.size());
+
+	int i = 0;
+	while (i < count)
+	{
+		if (mDirtyFlags[i])
 		{
-			UpdateHierarchyRecursive(child);
+			mDirtyRoots.push_back(i);
+			mRecomputedCount += mSubtreeSizes[i];
+			i += mSubtreeSizes[i];
 		}
+		else if (mDirtyDescendantFlags[i])
+		{
+			// look for the dirty transformations inside
+			mDirtyDescendantFlags[i] = 0;
+			i++;
+		}
+		else
+		{
+			// nothing changed in this subtree
+			i += mSubtreeSizes[i];
+		}
+	}
+
+	// each subtree only reads the world transformation of its root's parent, which is not being
+	// recomputed, so they can be processed in any order and give the same result as the serial path
+	if (mRecomputedCount < mParallelThreshold || mDirtyRoots.size() < 2)
+	{
+		for (int root : mDirtyRoots)
+		{
+			UpdateSubtree(root);
+		}
+	}
+	else
+	{
+		JobSystem::GetInstance().ParallelFor(mDirtyRoots.size(), 1, [this](size_t begin, size_t end) {
+			for (size_t j = begin; j < end; j++)
+			{
+				UpdateSubtree(mDirtyRoots[j]);
+			}
+		});
 	}
 }
 
@@ -50,18 +313,155 @@ void HierarchyManager::AddComponent(TransformationComponent* component)
 		return;
 	}
 
-	if (std::find(mRootTransformations.begin(), mRootTransformations.end(), component) == mRootTransformations.end())
+	// already registered
+	if (component->mIndex != INVALID_INDEX)
 	{
-		mRootTransformations.push_back(component);
+		return;
 	}
+
+	component->mIndex = static_cast<int>(mComponents.size());
+
+	mComponents.push_back(component);
+	mParentIndices.push_back(INVALID_INDEX);
+	mSubtreeSizes.push_back(1);
+	mLocalTransformations.push_back(Transformation {});
+	mWorldTransformations.push_back(Transformation {});
+	mWorldMatrices.push_back(glm::identity<glm::mat4>());
+	mDirtyFlags.push_back(1);
+	mDirtyDescendantFlags.push_back(0);
+
+	// there is nothing to interpolate from until the next step
+	mMotionFlags.push_back(SPAWNED);
+	mPreviousWorldTransformations.push_back(Transformation {});
+	mInterpolatedMatrices.push_back(glm::identity<glm::mat4>());
+
+	mNeedsSorting = true;
 }
 
 void HierarchyManager::RemoveComponent(TransformationComponent* component)
 {
-	if (component == nullptr)
+	if (component == nullptr || component->mIndex == INVALID_INDEX)
 	{
 		return;
 	}
 
-	mRootTransformations.remove(component);
+	// children of this transformation become parent-most ones
+	if (GameObject* owner = component->GetOwner())
+	{
+		for (GameObject* child : owner->GetChildren())
+		{
+			TransformationComponent* child_component = child->GetComponent<TransformationComponent>();
+			if (child_component != nullptr && child_component->mParent == component->GetHandle())
+			{
+				child_component->SetParent(nullptr);
+			}
+		}
+	}
+
+	// move the last transformation into the freed slot
+	int index = component->mIndex;
+	int last  = static_cast<int>(mComponents.size()) - 1;
+
+	if (index != last)
+	{
+		mComponents[index]			 = mComponents[last];
+		mLocalTransformations[index] = mLocalTransformations[last];
+		mWorldTransformations[index] = mWorldTransformations[last];
+		mWorldMatrices[index]		 = mWorldMatrices[last];
+		mDirtyFlags[index]			 = mDirtyFlags[last];
+		mMotionFlags[index]			 = mMotionFlags[last];
+
+		mPreviousWorldTransformations[index] = mPreviousWorldTransformations[last];
+		mInterpolatedMatrices[index]		 = mInterpolatedMatrices[last];
+
+		mComponents[index]->mIndex = index;
+	}
+
+	mComponents.pop_back();
+	mParentIndices.pop_back();
+	mSubtreeSizes.pop_back();
+	mLocalTransformations.pop_back();
+	mWorldTransformations.pop_back();
+	mWorldMatrices.pop_back();
+	mDirtyFlags.pop_back();
+	mDirtyDescendantFlags.pop_back();
+	mMotionFlags.pop_back();
+	mPreviousWorldTransformations.pop_back();
+	mInterpolatedMatrices.pop_back();
+
+	component->mIndex = INVALID_INDEX;
+
+	mNeedsSorting = true;
+}
+
+void HierarchyManager::MarkHierarchyChanged()
+{
+	mNeedsSorting = true;
+}
+
+void HierarchyManager::MarkDirty(TransformationComponent* component)
+{
+	if (component == nullptr || component->mIndex == INVALID_INDEX)
+	{
+		return;
+	}
+
+	StorePreviousWorld(component->mIndex);
+
+	mDirtyFlags[component->mIndex] = 1;
+
+	// the ancestors are flagged again after sorting, or by the next Update() when deferring
+	if (mNeedsSorting || mDeferredUpdates)
+	{
+		return;
+	}
+
+	// let the ancestors know, stopping as soon as one of them already knew
+	int parent = mParentIndices[component->mIndex];
+	while (parent != INVALID_INDEX && mDirtyDescendantFlags[parent] == 0)
+	{
+		mDirtyDescendantFlags[parent] = 1;
+		parent						  = mParentIndices[parent];
+	}
+}
+
+void HierarchyManager::SetDeferredUpdates(bool enabled)
+{
+	// whatever was flagged meanwhile still has to reach its ancestors
+	if (mDeferredUpdates && !enabled)
+	{
+		mNeedsDirtyPropagation = true;
+	}
+
+	mDeferredUpdates = enabled;
+}
+
+bool HierarchyManager::IsDeferringUpdates() const
+{
+	return mDeferredUpdates;
+}
+
+const glm::mat4& HierarchyManager::GetRenderMatrix(int index) const
+{
+	return mMotionFlags[index] == MOVED ? mInterpolatedMatrices[index] : mWorldMatrices[index];
+}
+
+size_t HierarchyManager::GetTransformationCount() const
+{
+	return mComponents.size();
+}
+
+size_t HierarchyManager::GetRecomputedCount() const
+{
+	return mRecomputedCount;
+}
+
+void HierarchyManager::SetParallelThreshold(size_t threshold)
+{
+	mParallelThreshold = threshold;
+}
+
+size_t HierarchyManager::GetParallelThreshold() const
+{
+	return mParallelThreshold;
 }
\ No newline at end of file
@@ -1,21 +1,114 @@
 #ifndef HIERARCHYMANAGER_HPP
 #define HIERARCHYMANAGER_HPP
 
+#include <Memory/TrackedAllocator.hpp>
 #include <Utils/Singleton.hpp>
-#include <list>
+#include "Transformation.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
 
 class TransformationComponent;
 
+// owns the data of every TransformationComponent as parallel arrays
+// indexed by TransformationComponent::mIndex
+// once sorted, the arrays are in depth-first order: every parent is stored before its children
+// and the subtree of a transformation is the contiguous range [index, index + subtree size)
+// every simulation step keeps the world transformation the moved ones had when it began,
+// so that rendering can interpolate between the last two steps
 class HierarchyManager : public Singleton<HierarchyManager>
 {
-		std::list<TransformationComponent*> mRootTransformations;
+		friend class TransformationComponent;
+
+		// the per-transformation arrays are accounted to MemoryTag::Transforms
+		template <typename T>
+		using TransformArray = TrackedVector<T, MemoryTag::Transforms>;
+
+		TransformArray<TransformationComponent*> mComponents;
+		TransformArray<int>						 mParentIndices;
+		TransformArray<int>						 mSubtreeSizes;
+		TransformArray<Transformation>			 mLocalTransformations;
+		TransformArray<Transformation>			 mWorldTransformations;
+		TransformArray<glm::mat4>				 mWorldMatrices;
+
+		// the transformation changed, its whole subtree needs to be recomputed
+		TransformArray<uint8_t> mDirtyFlags;
+
+		// some transformation below this one is dirty
+		TransformArray<uint8_t> mDirtyDescendantFlags;
+
+		// STATIC, MOVED or SPAWNED during the current step
+		TransformArray<uint8_t> mMotionFlags;
+
+		// only meaningful for the MOVED transformations
+		TransformArray<Transformation> mPreviousWorldTransformations;
+		TransformArray<glm::mat4>	   mInterpolatedMatrices;
+
+		// parent indices and subtree sizes are only valid while this is false
+		bool mNeedsSorting = false;
+
+		// while set, transformations are changed from several threads (see LogicSystem), each one only
+		// flags itself and the ancestors are flagged by the next Update()
+		bool mDeferredUpdates		= false;
+		bool mNeedsDirtyPropagation = false;
+
+		// roots of the subtrees to recompute this frame, independent from each other
+		std::vector<int> mDirtyRoots;
+
+		size_t mRecomputedCount	 = 0;
+		size_t mParallelThreshold = DEFAULT_PARALLEL_THRESHOLD;
+
+		void SortHierarchy();
+		void PropagateDirtyFlags();
+		void UpdateSubtree(int root);
+
+		// keeps the world transformation as it was when the step began, the first time it changes
+		void StorePreviousWorld(int index);
 
 	public:
+		static constexpr int	INVALID_INDEX			   = -1;
+		static constexpr size_t DEFAULT_PARALLEL_THRESHOLD = 2048;
+
+		// motion of a transformation during the current step
+		static constexpr uint8_t STATIC	 = 0;
+		static constexpr uint8_t MOVED	 = 1;
+		static constexpr uint8_t SPAWNED = 2;
+
 		void Update();
 		void Shutdown();
 
+		// to be called before each simulation step, what moved in the previous one is now at rest
+		void BeginStep();
+
+		// blends the moved transformations between the previous and the current step,
+		// alpha being how far the rendered frame is into the next step
+		void Interpolate(float alpha);
+
 		void AddComponent(TransformationComponent* component);
 		void RemoveComponent(TransformationComponent* component);
+
+		// to be called whenever a transformation changes its parent
+		void MarkHierarchyChanged();
+
+		// to be called whenever a local transformation changes
+		void MarkDirty(TransformationComponent* component);
+
+		// while enabled, changing a transformation does not recompute its world transformation either,
+		// it is only brought up to date by the next Update()
+		void SetDeferredUpdates(bool enabled);
+		bool IsDeferringUpdates() const;
+
+		// the interpolated world matrix while the transformation is moving, the world matrix otherwise
+		const glm::mat4& GetRenderMatrix(int index) const;
+
+		size_t GetTransformationCount() const;
+
+		// transformations recomputed during the last Update()
+		size_t GetRecomputedCount() const;
+
+		// below this many transformations to recompute, the update stays on the calling thread
+		void   SetParallelThreshold(size_t threshold);
+		size_t GetParallelThreshold() const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,294 @@
+#include "MatrixKernel.hpp"
+#include "Transformation.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#	define MATRIX_KERNEL_X86
+#	include <immintrin.h>
+#	if defined(_MSC_VER) && !defined(__clang__)
+#		include <intrin.h>
+// msvc allows avx intrinsics without compiling the whole file for avx
+#		define MATRIX_KERNEL_AVX_TARGET
+#	else
+#		define MATRIX_KERNEL_AVX_TARGET __attribute__((target("avx")))
+#	endif
+#endif
+
+namespace
+{
+	using KernelFunction = void (*)(const Transformation*, glm::mat4*, size_t);
+
+	void BuildWorldMatricesScalar(const Transformation* transformations, glm::mat4* matrices, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			matrices[i] = transformations[i].GetMatrix();
+		}
+	}
+
+#ifdef MATRIX_KERNEL_X86
+	// quaternion to rotation matrix (same terms as glm::mat3_cast), scaled per column:
+	// column 0 = ( 1 - 2(yy + zz),     2(xy + wz),     2(xz - wy) ) * scale.x
+	// column 1 = (     2(xy - wz), 1 - 2(xx + zz),     2(yz + wx) ) * scale.y
+	// column 2 = (     2(xz + wy),     2(yz - wx), 1 - 2(xx + yy) ) * scale.z
+	// column 3 = position
+
+	// each transformation is read as consecutive floats: position xyz, scale xyz, orientation xyzw
+	constexpr size_t TRANSFORMATION_FLOATS = sizeof(Transformation) / sizeof(float);
+	constexpr size_t SCALE_OFFSET		   = offsetof(Transformation, scale) / sizeof(float);
+	constexpr size_t ORIENTATION_OFFSET	   = offsetof(Transformation, rotation) / sizeof(float);
+
+	static_assert(TRANSFORMATION_FLOATS == 10 && SCALE_OFFSET == 3 && ORIENTATION_OFFSET == 6,
+		"the kernels expect a transformation to be 10 tightly packed floats");
+	static_assert(offsetof(glm::quat, x) == 0, "the kernels expect the orientation stored as x, y, z, w");
+
+	// loads 4 floats from the same offset of 4 consecutive transformations and transposes them,
+	// so that each register holds one component of all 4
+	// the helpers are inline, called out of line their results go through the stack
+	inline void LoadComponentsSSE(const float* t, size_t offset, __m128& a, __m128& b, __m128& c, __m128& d)
+	{
+		a = _mm_loadu_ps(t + offset);
+		b = _mm_loadu_ps(t + offset + TRANSFORMATION_FLOATS);
+		c = _mm_loadu_ps(t + offset + 2 * TRANSFORMATION_FLOATS);
+		d = _mm_loadu_ps(t + offset + 3 * TRANSFORMATION_FLOATS);
+		_MM_TRANSPOSE4_PS(a, b, c, d);
+	}
+
+	void BuildWorldMatricesSSE(const Transformation* transformations, glm::mat4* matrices, size_t count)
+	{
+		const __m128 one  = _mm_set1_ps(1.0f);
+		const __m128 two  = _mm_set1_ps(2.0f);
+		const __m128 zero = _mm_setzero_ps();
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const float* t = reinterpret_cast<const float*>(transformations + i);
+
+			// 3 loads of 4 floats per transformation, the middle one starts at scale.y and ends inside the orientation
+			__m128 px, py, pz, sx, sy, sz, x, y, z, w, unused_x, unused_y;
+			LoadComponentsSSE(t, 0, px, py, pz, sx);
+			LoadComponentsSSE(t, SCALE_OFFSET + 1, sy, sz, unused_x, unused_y);
+			LoadComponentsSSE(t, ORIENTATION_OFFSET, x, y, z, w);
+
+			__m128 xx = _mm_mul_ps(x, x);
+			__m128 yy = _mm_mul_ps(y, y);
+			__m128 zz = _mm_mul_ps(z, z);
+			__m128 xy = _mm_mul_ps(x, y);
+			__m128 xz = _mm_mul_ps(x, z);
+			__m128 yz = _mm_mul_ps(y, z);
+			__m128 wx = _mm_mul_ps(w, x);
+			__m128 wy = _mm_mul_ps(w, y);
+			__m128 wz = _mm_mul_ps(w, z);
+
+			__m128 c0[4] = {
+				_mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx),
+				zero,
+			};
+			__m128 c1[4] = {
+				_mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy),
+				_mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy),
+				zero,
+			};
+			__m128 c2[4] = {
+				_mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz),
+				_mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz),
+				zero,
+			};
+			__m128 c3[4] = { px, py, pz, one };
+
+			// back from one register per component to one register per column
+			_MM_TRANSPOSE4_PS(c0[0], c0[1], c0[2], c0[3]);
+			_MM_TRANSPOSE4_PS(c1[0], c1[1], c1[2], c1[3]);
+			_MM_TRANSPOSE4_PS(c2[0], c2[1], c2[2], c2[3]);
+			_MM_TRANSPOSE4_PS(c3[0], c3[1], c3[2], c3[3]);
+
+			for (int k = 0; k < 4; k++)
+			{
+				float* m = &matrices[i + k][0][0];
+				_mm_storeu_ps(m + 0, c0[k]);
+				_mm_storeu_ps(m + 4, c1[k]);
+				_mm_storeu_ps(m + 8, c2[k]);
+				_mm_storeu_ps(m + 12, c3[k]);
+			}
+		}
+
+		BuildWorldMatricesScalar(transformations + i, matrices + i, count - i);
+	}
+
+	// 4x4 transpose of each 128 bit half
+	MATRIX_KERNEL_AVX_TARGET inline void TransposeAVX(__m256& a, __m256& b, __m256& c, __m256& d)
+	{
+		__m256 t0 = _mm256_unpacklo_ps(a, b);
+		__m256 t1 = _mm256_unpackhi_ps(a, b);
+		__m256 t2 = _mm256_unpacklo_ps(c, d);
+		__m256 t3 = _mm256_unpackhi_ps(c, d);
+
+		a = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+		b = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+		c = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+		d = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	// same as LoadComponentsSSE() for 8 transformations, 0 to 3 in the low halves and 4 to 7 in the high halves
+	MATRIX_KERNEL_AVX_TARGET inline void LoadComponentsAVX(
+		const float* t, size_t offset, __m256& a, __m256& b, __m256& c, __m256& d)
+	{
+		__m256 r[4];
+		for (size_t k = 0; k < 4; k++)
+		{
+			const float* low = t + offset + k * TRANSFORMATION_FLOATS;
+			r[k] = _mm256_insertf128_ps(
+				_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(low + 4 * TRANSFORMATION_FLOATS), 1);
+		}
+
+		TransposeAVX(r[0], r[1], r[2], r[3]);
+		a = r[0];
+		b = r[1];
+		c = r[2];
+		d = r[3];
+	}
+
+	// transposes 8 lanes of 4 components into 8 columns and stores them at the given column offset
+	MATRIX_KERNEL_AVX_TARGET inline void StoreColumnsAVX(
+		const __m256& a, const __m256& b, const __m256& c, const __m256& d, glm::mat4* matrices, int column)
+	{
+		// the low halves hold matrices 0 to 3, the high halves 4 to 7
+		__m256 r[4] = { a, b, c, d };
+		TransposeAVX(r[0], r[1], r[2], r[3]);
+
+		for (int k = 0; k < 4; k++)
+		{
+			_mm_storeu_ps(&matrices[k][column][0], _mm256_castps256_ps128(r[k]));
+			_mm_storeu_ps(&matrices[k + 4][column][0], _mm256_extractf128_ps(r[k], 1));
+		}
+	}
+
+	MATRIX_KERNEL_AVX_TARGET void BuildWorldMatricesAVX(const Transformation* transformations, glm::mat4* matrices, size_t count)
+	{
+		const __m256 one  = _mm256_set1_ps(1.0f);
+		const __m256 two  = _mm256_set1_ps(2.0f);
+		const __m256 zero = _mm256_setzero_ps();
+
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const float* t = reinterpret_cast<const float*>(transformations + i);
+
+			__m256 px, py, pz, sx, sy, sz, x, y, z, w, unused_x, unused_y;
+			LoadComponentsAVX(t, 0, px, py, pz, sx);
+			LoadComponentsAVX(t, SCALE_OFFSET + 1, sy, sz, unused_x, unused_y);
+			LoadComponentsAVX(t, ORIENTATION_OFFSET, x, y, z, w);
+
+			__m256 xx = _mm256_mul_ps(x, x);
+			__m256 yy = _mm256_mul_ps(y, y);
+			__m256 zz = _mm256_mul_ps(z, z);
+			__m256 xy = _mm256_mul_ps(x, y);
+			__m256 xz = _mm256_mul_ps(x, z);
+			__m256 yz = _mm256_mul_ps(y, z);
+			__m256 wx = _mm256_mul_ps(w, x);
+			__m256 wy = _mm256_mul_ps(w, y);
+			__m256 wz = _mm256_mul_ps(w, z);
+
+			StoreColumnsAVX(
+				_mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(yy, zz))), sx),
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, wz)), sx),
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, wy)), sx),
+				zero,
+				matrices + i,
+				0);
+			StoreColumnsAVX(
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), sy),
+				_mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, zz))), sy),
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, wx)), sy),
+				zero,
+				matrices + i,
+				1);
+			StoreColumnsAVX(
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, wy)), sz),
+				_mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), sz),
+				_mm256_mul_ps(_mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, yy))), sz),
+				zero,
+				matrices + i,
+				2);
+			StoreColumnsAVX(px, py, pz, one, matrices + i, 3);
+		}
+
+		// avoid the avx to sse transition penalty in the code that follows
+		_mm256_zeroupper();
+
+		BuildWorldMatricesScalar(transformations + i, matrices + i, count - i);
+	}
+
+	bool SupportsSSE()
+	{
+#if defined(_M_X64) || defined(__x86_64__)
+		// part of the x86-64 baseline
+		return true;
+#elif defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 1);
+		return (info[3] & (1 << 25)) != 0;
+#else
+		return __builtin_cpu_supports("sse");
+#endif
+	}
+
+	bool SupportsAVX()
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 1);
+
+		// the os also has to save the ymm registers on context switches
+		const bool avx	   = (info[2] & (1 << 28)) != 0;
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		return avx && osxsave && (_xgetbv(0) & 0x6) == 0x6;
+#else
+		return __builtin_cpu_supports("avx");
+#endif
+	}
+#endif
+
+	struct Kernel
+	{
+			KernelFunction function;
+			const char*	   name;
+	};
+
+	Kernel SelectKernel()
+	{
+#ifdef MATRIX_KERNEL_X86
+		if (SupportsAVX())
+		{
+			return { &BuildWorldMatricesAVX, "AVX" };
+		}
+
+		if (SupportsSSE())
+		{
+			return { &BuildWorldMatricesSSE, "SSE" };
+		}
+#endif
+
+		return { &BuildWorldMatricesScalar, "Scalar" };
+	}
+
+	const Kernel& GetKernel()
+	{
+		static const Kernel kernel = SelectKernel();
+		return kernel;
+	}
+}
+
+void BuildWorldMatrices(const Transformation* transformations, glm::mat4* matrices, size_t count)
+{
+	GetKernel().function(transformations, matrices, count);
+}
+
+const char* GetMatrixKernelName()
+{
+	return GetKernel().name;
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef MATRIX_KERNEL_HPP
+#define MATRIX_KERNEL_HPP
+
+#include <glm/glm.hpp>
+#include <cstddef>
+
+struct Transformation;
+
+// writes transformations[i].GetMatrix() into matrices[i] for the whole range,
+// using the widest instruction set the cpu supports (AVX, SSE or scalar)
+void BuildWorldMatrices(const Transformation* transformations, glm::mat4* matrices, size_t count);
+
+// name of the path picked at runtime, for debugging and benchmarks
+const char* GetMatrixKernelName();
+
+#endif
\ No newline at end of file
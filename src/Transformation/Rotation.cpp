@@ -1,32 +1,66 @@
 #include "Rotation.hpp"
 
-#define GLM_ENABLE_EXPERIMENTAL
-#include <glm/gtx/normal.hpp>
-#include <glm/gtx/rotate_normalized_axis.hpp>
-
 Rotation::Rotation()
-	: forward { 0.0f, 0.0f, -1.0f }, up { 0.0f, 1.0f, 0.0f }, right {1.0f, 0.0f, 0.0f}
+	: orientation { 1.0f, 0.0f, 0.0f, 0.0f }
 {
+}
 
+Rotation::Rotation(glm::quat orientation)
+	: orientation { orientation }
+{
 }
 
 Rotation::Rotation(glm::vec3 forward, glm::vec3 up)
-	: forward { forward }, up { up }
+	: Rotation(forward, up, glm::normalize(glm::cross(forward, up)))
 {
-	right = glm::normalize(glm::cross(forward, up));
 }
 
 Rotation::Rotation(glm::vec3 forward, glm::vec3 up, glm::vec3 right)
-	: forward { forward }, up { up }, right {right}
 {
+	// orthonormalize the basis the same way a look-at would
+	forward = glm::normalize(forward);
+	right	= glm::normalize(right);
+	up		= glm::cross(right, forward);
 
+	orientation = glm::normalize(glm::quat_cast(glm::mat3 { right, up, -forward }));
 }
 
 void Rotation::RotateAxis(float angle, glm::vec3 axis)
 {
-	glm::mat4 rotation_mtx = glm::rotateNormalizedAxis(glm::mat4 { 1.0f }, angle, axis);
+	orientation = glm::normalize(glm::angleAxis(angle, glm::normalize(axis)) * orientation);
+}
+
+glm::vec3 Rotation::GetForward() const
+{
+	return orientation * VECTOR_FORWARD;
+}
+
+glm::vec3 Rotation::GetUp() const
+{
+	return orientation * VECTOR_UP;
+}
+
+glm::vec3 Rotation::GetRight() const
+{
+	return orientation * VECTOR_RIGHT;
+}
+
+glm::mat3 Rotation::GetMatrix() const
+{
+	return glm::mat3_cast(orientation);
+}
 
-	forward = glm::normalize(glm::vec3(rotation_mtx * glm::vec4 { forward, 0.0f }));
-	up		 = glm::normalize(glm::vec3(rotation_mtx * glm::vec4 { up, 0.0f }));
-	right	 = glm::normalize(glm::vec3(rotation_mtx * glm::vec4 { right, 0.0f }));
+Rotation Rotation::Concatenate(const Rotation& child) const
+{
+	return Rotation { orientation * child.orientation };
 }
+
+Rotation Rotation::operator*(const Rotation& child) const
+{
+	return Concatenate(child);
+}
+
+Rotation Rotation::Inverse() const
+{
+	return Rotation { glm::conjugate(orientation) };
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define ROTATION_HPP
 
 #include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
 
 struct Rotation
 {
@@ -10,14 +11,25 @@ struct Rotation
 		static constexpr glm::vec3 VECTOR_RIGHT	  = glm::vec3 { 1.0f, 0.0f, 0.0f };
 
 		Rotation();
+		Rotation(glm::quat orientation);
 		Rotation(glm::vec3 forward, glm::vec3 up = glm::vec3 { 0.f, 1.f, 0.f });
 		Rotation(glm::vec3 forward, glm::vec3 up, glm::vec3 right);
 
 		void RotateAxis(float angle, glm::vec3 axis);
 
-		glm::vec3 forward;
-		glm::vec3 up;
-		glm::vec3 right;
+		// basis vectors, computed from the orientation
+		glm::vec3 GetForward() const;
+		glm::vec3 GetUp() const;
+		glm::vec3 GetRight() const;
+
+		// the basis vectors are its columns: right, up and -forward
+		glm::mat3 GetMatrix() const;
+
+		Rotation Concatenate(const Rotation& child) const;
+		Rotation operator*(const Rotation& child) const;
+		Rotation Inverse() const;
+
+		glm::quat orientation;
 };
 
 #endif
\ No newline at end of file
@@ -24,28 +24,101 @@ Transformation ExtractTransformation(const glm::mat4& matrix)
 
 	// get the information from the input matrix
 	glm::decompose(matrix, scale, rotation, translation, skew, perspective);
-	glm::highp_quat inverse_rotation = glm::inverse(glm::conjugate(rotation));
 
 	// fill the resulting transformation with it
 	Transformation result;
-	result.position			= translation;
-	result.scale			= scale;
-	result.rotation.forward = glm::normalize(glm::rotate(inverse_rotation, glm::vec4 { 0.0f, 0.0f, -1.0f, 0.0f }));
-	result.rotation.up		= glm::normalize(glm::rotate(inverse_rotation, glm::vec4 { 0.0f, 1.0f, 0.0f, 0.0f }));
-	result.rotation.right	= glm::normalize(glm::rotate(inverse_rotation, glm::vec4 { 1.0f, 0.0f, 0.0f, 0.0f }));
+	result.position				= translation;
+	result.scale				= scale;
+	result.rotation.orientation = glm::normalize(rotation);
 
 	return result;
 }
 
 glm::mat4 Transformation::GetMatrix() const
 {
-	glm::mat4 lookat	= glm::lookAt(position, position + rotation.forward, rotation.up);
-	glm::mat4 world_mtx = glm::inverse(lookat) * glm::scale(glm::mat4 { 1.0f }, scale);
+	// translation * rotation * scale, built directly
+	glm::mat3 rotation_mtx = rotation.GetMatrix();
+
+	glm::mat4 world_mtx { 1.0f };
+	world_mtx[0] = glm::vec4 { rotation_mtx[0] * scale.x, 0.0f };
+	world_mtx[1] = glm::vec4 { rotation_mtx[1] * scale.y, 0.0f };
+	world_mtx[2] = glm::vec4 { rotation_mtx[2] * scale.z, 0.0f };
+	world_mtx[3] = glm::vec4 { position, 1.0f };
 
 	return world_mtx;
 }
 
+namespace
+{
+	// relative, scales coming out of a matrix decomposition or a long chain of concatenations
+	// differ from each other by a lot more than a single epsilon
+	constexpr float SCALE_UNIFORMITY_TOLERANCE = 1e-5f;
+
+	bool IsUniform(const glm::vec3& scale)
+	{
+		// not clamped to 1, small scales are as much affected by shear as large ones
+		const glm::vec3 magnitude = glm::abs(scale);
+		const float		largest	  = glm::max(glm::max(magnitude.x, magnitude.y), magnitude.z);
+		const float		tolerance = SCALE_UNIFORMITY_TOLERANCE * largest;
+		return glm::abs(scale.x - scale.y) <= tolerance && glm::abs(scale.x - scale.z) <= tolerance;
+	}
+
+	// rotations built from 90 degree turns are only axis aligned up to rounding
+	constexpr float AXIS_ALIGNMENT_TOLERANCE = 1e-5f;
+
+	// true if the rotation turns every axis onto an axis (possibly flipped), axes[i] is where axis i ends up
+	bool IsAxisAligned(const Rotation& rotation, int (&axes)[3])
+	{
+		glm::mat3 rotation_mtx = rotation.GetMatrix();
+
+		for (int axis = 0; axis < 3; axis++)
+		{
+			axes[axis] = -1;
+
+			for (int component = 0; component < 3; component++)
+			{
+				if (glm::abs(rotation_mtx[axis][component]) >= 1.0f - AXIS_ALIGNMENT_TOLERANCE)
+				{
+					axes[axis] = component;
+				}
+			}
+
+			if (axes[axis] < 0)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
 Transformation Transformation::Concatenate(const Transformation& child_local) const
+{
+	glm::vec3 parent_scale = scale;
+
+	if (!IsUniform(scale))
+	{
+		// a non-uniform scale applied over a rotated child shears it
+		int axes[3];
+		if (!IsAxisAligned(child_local.rotation, axes))
+		{
+			return ConcatenateMatrices(child_local);
+		}
+
+		// unless the child axes land on the parent ones, then each of them takes the scale of that axis
+		parent_scale = glm::vec3 { scale[axes[0]], scale[axes[1]], scale[axes[2]] };
+	}
+
+	Transformation result;
+	result.position = position + rotation.orientation * (scale * child_local.position);
+	result.scale	= parent_scale * child_local.scale;
+	result.rotation = rotation * child_local.rotation;
+
+	return result;
+}
+
+Transformation Transformation::ConcatenateMatrices(const Transformation& child_local) const
 {
 	glm::mat4 child_model_to_world = GetMatrix() * child_local.GetMatrix();
 
@@ -64,13 +137,21 @@ Transformation Transformation::InverseConcatenate(const Transformation& child_wo
 	return ExtractTransformation(child_world_to_model);
 }
 
+Transformation Transformation::Interpolate(const Transformation& target, float alpha) const
+{
+	Transformation result;
+	result.position				= glm::mix(position, target.position, alpha);
+	result.scale				= glm::mix(scale, target.scale, alpha);
+	result.rotation.orientation = glm::slerp(rotation.orientation, target.rotation.orientation, alpha);
+
+	return result;
+}
+
 void Transformation::LookAt(glm::vec3 target)
 {
 	// do not deal with zero vectors
 	if (glm::all(glm::epsilonEqual(target, position, glm::epsilon<float>())))
 		return;
 
-	rotation.forward = glm::normalize(target - position);
-	rotation.right	 = glm::normalize(glm::cross(rotation.forward, glm::vec3 { 0.0f, 1.0f, 0.0f }));
-	rotation.up		 = glm::normalize(glm::cross(rotation.right, rotation.forward));
+	rotation = Rotation { glm::normalize(target - position), Rotation::VECTOR_UP };
 }
\ No newline at end of file
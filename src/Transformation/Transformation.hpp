@@ -13,10 +13,16 @@ struct Transformation
 
 		glm::mat4 GetMatrix() const;
 
+		// composes position, rotation and scale directly, falls back to ConcatenateMatrices()
+		// when the result has shear (non-uniform scale above a child not rotated onto the axes) that TRS cannot hold
 		Transformation Concatenate(const Transformation& child_local) const;
+		Transformation ConcatenateMatrices(const Transformation& child_local) const;
 		Transformation operator*(const Transformation& child_local) const;
 		Transformation InverseConcatenate(const Transformation& child_world) const;
 
+		// linear on position and scale, spherical on rotation (shortest path)
+		Transformation Interpolate(const Transformation& target, float alpha) const;
+
 		void LookAt(glm::vec3 target);
 
 		glm::vec3 position;
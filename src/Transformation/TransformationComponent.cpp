@@ -4,89 +4,105 @@
 #include "HierarchyManager.hpp"
 
 TransformationComponent::TransformationComponent()
-	: mWorldMatrix { glm::identity<glm::mat4>() }, mParent { nullptr }
+	: mIndex { HierarchyManager::INVALID_INDEX }, mParent {}
 {
+	// the storage is needed right away, setters may be called before Initialize()
+	HierarchyManager::GetInstance().AddComponent(this);
+}
+
+TransformationComponent::~TransformationComponent()
+{
+	HierarchyManager::GetInstance().RemoveComponent(this);
+}
+
+Transformation& TransformationComponent::LocalTransformation()
+{
+	return HierarchyManager::GetInstance().mLocalTransformations[mIndex];
+}
+
+Transformation& TransformationComponent::WorldTransformation()
+{
+	return HierarchyManager::GetInstance().mWorldTransformations[mIndex];
+}
+
+TransformationComponent* TransformationComponent::GetParentTransformation() const
+{
+	// only transformations are ever stored as parents
+	return static_cast<TransformationComponent*>(Component::Resolve(mParent));
 }
 
 void TransformationComponent::SetParent(TransformationComponent* parent)
 {
-	mParent = parent;
+	mParent = parent != nullptr ? parent->GetHandle() : ComponentHandle {};
 
 	if (parent != nullptr)
 	{
 		// now this transformation is a child
-		mLocalTransformation = parent->GetWorldTransformation().InverseConcatenate(mWorldTransformation);
+		LocalTransformation() = parent->GetWorldTransformation().InverseConcatenate(WorldTransformation());
 	}
 	else
 	{
 		// now this transformation is parent-most
-		mLocalTransformation = mWorldTransformation;
-
-		// only parent-most transformations are in the system
-		AddToSystem();
+		LocalTransformation() = WorldTransformation();
 	}
 
-	Update();
-}
+	// parents need to be stored before their children again
+	HierarchyManager::GetInstance().MarkHierarchyChanged();
 
-void TransformationComponent::AddToSystem()
-{
-	HierarchyManager::GetInstance().AddComponent(this);
+	Update();
 }
 
 void TransformationComponent::Initialize()
 {
-	// only parent-most tranformations will be added to the system
 	if (GameObject* parent = GetOwner()->GetParent())
 	{
 		SetParent(parent->GetComponent<TransformationComponent>());
 	}
-	else
-	{
-		AddToSystem();
-	}
 }
 
 void TransformationComponent::Update()
 {
-	if (mParent != nullptr)
+	HierarchyManager& hierarchy = HierarchyManager::GetInstance();
+
+	// the descendants will be refreshed by the HierarchyManager
+	hierarchy.MarkDirty(this);
+
+	// the parent may be moving on another thread, this one is recomputed along with it
+	if (hierarchy.IsDeferringUpdates())
+	{
+		return;
+	}
+
+	Transformation& world_transformation = hierarchy.mWorldTransformations[mIndex];
+
+	if (TransformationComponent* parent = GetParentTransformation())
 	{
 		// this is a child
-		mWorldTransformation = mParent->GetWorldTransformation() * mLocalTransformation;
+		world_transformation = parent->GetWorldTransformation() * hierarchy.mLocalTransformations[mIndex];
 	}
 	else
 	{
-		mWorldTransformation = mLocalTransformation;
+		world_transformation = hierarchy.mLocalTransformations[mIndex];
 	}
 
-	mWorldMatrix = mWorldTransformation.GetMatrix();
-}
-
-void TransformationComponent::Shutdown()
-{
-	RemoveFromSystem();
-}
-
-void TransformationComponent::RemoveFromSystem()
-{
-	HierarchyManager::GetInstance().RemoveComponent(this);
+	hierarchy.mWorldMatrices[mIndex] = world_transformation.GetMatrix();
 }
 
 void TransformationComponent::RotateAxis(float angle, glm::vec3 axis)
 {
-	mLocalTransformation.rotation.RotateAxis(angle, axis);
+	LocalTransformation().rotation.RotateAxis(angle, axis);
 	Update();
 }
 
 void TransformationComponent::LookAt(glm::vec3 target)
 {
-	mLocalTransformation.LookAt(target);
+	LocalTransformation().LookAt(target);
 	Update();
 }
 
 void TransformationComponent::SetLocalRotation(const Rotation& rotation)
 {
-	mLocalTransformation.rotation = rotation;
+	LocalTransformation().rotation = rotation;
 	Update();
 }
 
@@ -97,19 +113,20 @@ void TransformationComponent::SetLocalRotation(glm::vec3 forward, glm::vec3 up,
 
 void TransformationComponent::SetLocalPosition(glm::vec3 position)
 {
-	mLocalTransformation.position = position;
+	LocalTransformation().position = position;
 	Update();
 }
 
 void TransformationComponent::SetLocalScale(glm::vec3 scale)
 {
-	mLocalTransformation.scale = scale;
+	LocalTransformation().scale = scale;
 	Update();
 }
 
 void TransformationComponent::SetWorldRotation(const Rotation& rotation)
 {
-	if (mParent == nullptr)
+	TransformationComponent* parent = GetParentTransformation();
+	if (parent == nullptr)
 	{
 		SetLocalRotation(rotation);
 	}
@@ -118,7 +135,7 @@ void TransformationComponent::SetWorldRotation(const Rotation& rotation)
 		Transformation temp {};
 		temp.rotation = rotation;
 
-		SetLocalRotation(mParent->GetWorldTransformation().InverseConcatenate(temp).rotation);
+		SetLocalRotation(parent->GetWorldTransformation().InverseConcatenate(temp).rotation);
 	}
 }
 
@@ -129,7 +146,8 @@ void TransformationComponent::SetWorldRotation(glm::vec3 forward, glm::vec3 up,
 
 void TransformationComponent::SetWorldPosition(glm::vec3 position)
 {
-	if (mParent == nullptr)
+	TransformationComponent* parent = GetParentTransformation();
+	if (parent == nullptr)
 	{
 		SetLocalPosition(position);
 	}
@@ -138,13 +156,14 @@ void TransformationComponent::SetWorldPosition(glm::vec3 position)
 		Transformation temp {};
 		temp.position = position;
 
-		SetLocalPosition(mParent->GetWorldTransformation().InverseConcatenate(temp).position);
+		SetLocalPosition(parent->GetWorldTransformation().InverseConcatenate(temp).position);
 	}
 }
 
 void TransformationComponent::SetWorldScale(glm::vec3 scale)
 {
-	if (mParent == nullptr)
+	TransformationComponent* parent = GetParentTransformation();
+	if (parent == nullptr)
 	{
 		SetLocalScale(scale);
 	}
@@ -153,71 +172,77 @@ void TransformationComponent::SetWorldScale(glm::vec3 scale)
 		Transformation temp {};
 		temp.scale = scale;
 
-		SetLocalScale(mParent->GetWorldTransformation().InverseConcatenate(temp).scale);
+		SetLocalScale(parent->GetWorldTransformation().InverseConcatenate(temp).scale);
 	}
 }
 
 void TransformationComponent::SetLocalTransformation(const Transformation& transformation)
 {
-	mLocalTransformation = transformation;
+	LocalTransformation() = transformation;
 	Update();
 }
 
 void TransformationComponent::SetWorldTransformation(const Transformation& transformation)
 {
-	if (mParent == nullptr)
+	TransformationComponent* parent = GetParentTransformation();
+	if (parent == nullptr)
 	{
 		SetLocalTransformation(transformation);
 	}
 	else
 	{
-		SetLocalTransformation(mParent->GetWorldTransformation().InverseConcatenate(transformation));
+		SetLocalTransformation(parent->GetWorldTransformation().InverseConcatenate(transformation));
 	}
 }
 
 glm::vec3 TransformationComponent::GetLocalPosition() const
 {
-	return mLocalTransformation.position;
+	return GetLocalTransformation().position;
 }
 
 glm::vec3 TransformationComponent::GetLocalScale() const
 {
-	return mLocalTransformation.scale;
+	return GetLocalTransformation().scale;
 }
 
 Rotation TransformationComponent::GetLocalRotation() const
 {
-	return mLocalTransformation.rotation;
+	return GetLocalTransformation().rotation;
 }
 
 glm::vec3 TransformationComponent::GetWorldPosition() const
 {
-	return mWorldTransformation.position;
+	return GetWorldTransformation().position;
 }
 
 glm::vec3 TransformationComponent::GetWorldScale() const
 {
-	return mWorldTransformation.scale;
+	return GetWorldTransformation().scale;
 }
 
 Rotation TransformationComponent::GetWorldRotation() const
 {
-	return mWorldTransformation.rotation;
+	return GetWorldTransformation().rotation;
 }
 
 const Transformation& TransformationComponent::GetLocalTransformation() const
 {
-	return mLocalTransformation;
+	return HierarchyManager::GetInstance().mLocalTransformations[mIndex];
 }
 
 const glm::mat4& TransformationComponent::GetWorldMatrix() const
 {
-	return mWorldMatrix;
+	return HierarchyManager::GetInstance().mWorldMatrices[mIndex];
 }
 
 const Transformation& TransformationComponent::GetWorldTransformation() const
 {
-	return mWorldTransformation;
+	return HierarchyManager::GetInstance().mWorldTransformations[mIndex];
+}
+
+const glm::mat4& TransformationComponent::GetInterpolatedWorldMatrix() const
+{
+	return HierarchyManager::GetInstance().GetRenderMatrix(mIndex);
 }
 
 #include <imgui.h>
@@ -228,7 +253,7 @@ void TransformationComponent::Edit()
 
 	ImGui::Checkbox("World", &world);
 
-	Transformation tempTransformation = world ? mWorldTransformation : mLocalTransformation;
+	Transformation tempTransformation = world ? GetWorldTransformation() : GetLocalTransformation();
 
 	bool changed  = false;
 	changed		 |= ImGui::DragFloat3("Position", &tempTransformation.position[0]);
@@ -8,22 +8,25 @@
 class TransformationComponent : public Component
 {
 		friend class GameObject;
+		friend class HierarchyManager;
 
 		void SetParent(TransformationComponent* parent);
 
-		Transformation			 mLocalTransformation;
-		Transformation			 mWorldTransformation;
-		glm::mat4				 mWorldMatrix;
-		TransformationComponent* mParent;
+		// the transformation data is stored in the HierarchyManager arrays
+		int				mIndex;
+		ComponentHandle mParent;
+
+		TransformationComponent* GetParentTransformation() const;
+
+		Transformation& LocalTransformation();
+		Transformation& WorldTransformation();
 
 	public:
 		TransformationComponent();
+		virtual ~TransformationComponent();
 
-		virtual void AddToSystem() override;
 		virtual void Initialize() override;
 		virtual void Update() override;
-		virtual void Shutdown() override;
-		virtual void RemoveFromSystem() override;
 
 		void RotateAxis(float angle, glm::vec3 axis);
 		void LookAt(glm::vec3 target);
@@ -53,6 +56,9 @@ class TransformationComponent : public Component
 		const glm::mat4&	  GetWorldMatrix() const;
 		const Transformation& GetWorldTransformation() const;
 
+		// world matrix blended between the last two simulation steps, for rendering
+		const glm::mat4& GetInterpolatedWorldMatrix() const;
+
 		virtual void Edit() override;
 };
 
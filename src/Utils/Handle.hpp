@@ -0,0 +1,63 @@
+#ifndef HANDLE_HPP
+#define HANDLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// weak reference that can be stored across frames:
+// once the object it refers to is released, resolving it returns null instead of a dangling pointer
+template <typename T>
+class Handle
+{
+		template <typename U>
+		friend class HandleTable;
+
+		uint32_t mIndex;
+		uint32_t mGeneration;
+
+		Handle(uint32_t index, uint32_t generation);
+
+	public:
+		static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+		Handle();
+
+		// only tells whether the handle was ever assigned, the object may still be gone
+		bool IsNull() const;
+
+		bool operator==(const Handle& other) const;
+		bool operator!=(const Handle& other) const;
+};
+
+// slot table behind the handles, each slot stores the object and a generation
+// that is bumped whenever the slot is released, invalidating every handle to it
+template <typename T>
+class HandleTable
+{
+		struct Entry
+		{
+				T*		 object;
+				uint32_t generation;
+		};
+
+		std::vector<Entry>	  mEntries;
+		std::vector<uint32_t> mFreeIndices;
+
+	public:
+		Handle<T> Add(T* object);
+		void	  Remove(Handle<T> handle);
+
+		// the object moved in memory, keep the handles pointing at it
+		void Relocate(Handle<T> handle, T* object);
+
+		// null when the handle is stale or null
+		T* Resolve(Handle<T> handle) const;
+
+		size_t GetCount() const;
+};
+
+#include "Handle.inl"
+
+#endif
\ No newline at end of file
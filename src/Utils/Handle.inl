@@ -0,0 +1,101 @@
+#include "Handle.hpp"
+
+template <typename T>
+Handle<T>::Handle()
+	: mIndex { INVALID_INDEX }, mGeneration { 0 }
+{
+}
+
+template <typename T>
+Handle<T>::Handle(uint32_t index, uint32_t generation)
+	: mIndex { index }, mGeneration { generation }
+{
+}
+
+template <typename T>
+bool Handle<T>::IsNull() const
+{
+	return mIndex == INVALID_INDEX;
+}
+
+template <typename T>
+bool Handle<T>::operator==(const Handle& other) const
+{
+	return mIndex == other.mIndex && mGeneration == other.mGeneration;
+}
+
+template <typename T>
+bool Handle<T>::operator!=(const Handle& other) const
+{
+	return !(*this == other);
+}
+
+template <typename T>
+Handle<T> HandleTable<T>::Add(T* object)
+{
+	uint32_t index;
+
+	if (!mFreeIndices.empty())
+	{
+		index = mFreeIndices.back();
+		mFreeIndices.pop_back();
+	}
+	else
+	{
+		index = static_cast<uint32_t>(mEntries.size());
+		mEntries.push_back(Entry { nullptr, 0 });
+	}
+
+	mEntries[index].object = object;
+
+	return Handle<T> { index, mEntries[index].generation };
+}
+
+template <typename T>
+void HandleTable<T>::Remove(Handle<T> handle)
+{
+	if (Resolve(handle) == nullptr)
+	{
+		return;
+	}
+
+	Entry& entry = mEntries[handle.mIndex];
+	entry.object = nullptr;
+	entry.generation++;
+
+	mFreeIndices.push_back(handle.mIndex);
+}
+
+template <typename T>
+void HandleTable<T>::Relocate(Handle<T> handle, T* object)
+{
+	if (Resolve(handle) == nullptr)
+	{
+		return;
+	}
+
+	mEntries[handle.mIndex].object = object;
+}
+
+template <typename T>
+T* HandleTable<T>::Resolve(Handle<T> handle) const
+{
+	if (handle.mIndex >= mEntries.size())
+	{
+		return nullptr;
+	}
+
+	const Entry& entry = mEntries[handle.mIndex];
+	if (entry.generation != handle.mGeneration)
+	{
+		return nullptr;
+	}
+
+	return entry.object;
+}
+
+template <typename T>
+size_t HandleTable<T>::GetCount() const
+{
+	return mEntries.size() - mFreeIndices.size();
+}
\ No newline at end of file
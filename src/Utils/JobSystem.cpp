@@ -0,0 +1,219 @@
+#include "JobSystem.hpp"
+#include <Profiling/Profiler.hpp>
+#include <algorithm>
+#include <string>
+
+namespace
+{
+	// index of the worker running on this thread, none for any other thread
+	constexpr size_t	NO_WORKER	 = static_cast<size_t>(-1);
+	thread_local size_t worker_index = NO_WORKER;
+
+	// shared between the caller and the workers helping it, kept alive by whoever runs last
+	struct ParallelForBatch
+	{
+			const std::function<void(size_t, size_t)>* function;
+			size_t										count;
+			size_t										grain_size;
+			size_t										chunk_count;
+			std::atomic<size_t>							next_chunk { 0 };
+			std::atomic<size_t>							finished_chunks { 0 };
+
+			void RunChunks()
+			{
+				for (size_t chunk = next_chunk++; chunk < chunk_count; chunk = next_chunk++)
+				{
+					size_t begin = chunk * grain_size;
+					size_t end	 = std::min(begin + grain_size, count);
+
+					(*function)(begin, end);
+
+					finished_chunks++;
+				}
+			}
+	};
+}
+
+JobSystem::~JobSystem()
+{
+	Shutdown();
+}
+
+void JobSystem::Initialize(unsigned worker_count)
+{
+	Shutdown();
+
+	if (worker_count == 0)
+	{
+		unsigned hardware_threads = std::thread::hardware_concurrency();
+		worker_count			  = hardware_threads > 1 ? hardware_threads - 1 : 0;
+	}
+
+	mStopping = false;
+
+	// every queue exists before any worker may try to steal from it
+	for (unsigned i = 0; i < worker_count; i++)
+	{
+		mQueues.push_back(std::make_unique<WorkerQueue>());
+	}
+
+	mWorkers.reserve(worker_count);
+	for (unsigned i = 0; i < worker_count; i++)
+	{
+		mWorkers.emplace_back(&JobSystem::WorkerLoop, this, i);
+	}
+}
+
+void JobSystem::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(mSleepMutex);
+		mStopping = true;
+	}
+	mJobAvailable.notify_all();
+
+	for (std::thread& worker : mWorkers)
+	{
+		worker.join();
+	}
+
+	mWorkers.clear();
+	mQueues.clear();
+	mQueuedJobs = 0;
+}
+
+void JobSystem::Push(std::function<void()> job)
+{
+	// workers keep the jobs they spawn, other threads spread them around
+	size_t queue_index = worker_index != NO_WORKER ? worker_index : mNextQueue++ % mQueues.size();
+
+	{
+		std::lock_guard<std::mutex> lock(mQueues[queue_index]->mutex);
+		mQueues[queue_index]->jobs.push_back(std::move(job));
+	}
+
+	mQueuedJobs++;
+
+	// a worker about to sleep either sees the new count or is already waiting
+	{
+		std::lock_guard<std::mutex> lock(mSleepMutex);
+	}
+	mJobAvailable.notify_one();
+}
+
+bool JobSystem::TryTakeJob(std::function<void()>& job)
+{
+	const size_t queue_count = mQueues.size();
+	const size_t own_queue	 = worker_index != NO_WORKER ? worker_index : 0;
+
+	for (size_t i = 0; i < queue_count; i++)
+	{
+		size_t		 queue_index = (own_queue + i) % queue_count;
+		WorkerQueue& queue		 = *mQueues[queue_index];
+
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.jobs.empty())
+		{
+			continue;
+		}
+
+		// newest from our own queue (still warm in cache), oldest when stealing
+		if (queue_index == worker_index)
+		{
+			job = std::move(queue.jobs.back());
+			queue.jobs.pop_back();
+		}
+		else
+		{
+			job = std::move(queue.jobs.front());
+			queue.jobs.pop_front();
+		}
+
+		mQueuedJobs--;
+		return true;
+	}
+
+	return false;
+}
+
+void JobSystem::WorkerLoop(size_t index)
+{
+	worker_index = index;
+
+	Profiler::GetInstance().SetThreadName("Worker " + std::to_string(index));
+
+	while (true)
+	{
+		std::function<void()> job;
+		if (TryTakeJob(job))
+		{
+			PROFILE_ZONE("Job");
+			job();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(mSleepMutex);
+		mJobAvailable.wait(lock, [this]() { return mStopping || mQueuedJobs.load() > 0; });
+
+		// stopping and nothing left to do
+		if (mStopping && mQueuedJobs.load() == 0)
+		{
+			return;
+		}
+	}
+}
+
+void JobSystem::Submit(std::function<void()> job)
+{
+	if (mWorkers.empty())
+	{
+		job();
+		return;
+	}
+
+	Push(std::move(job));
+}
+
+void JobSystem::ParallelFor(size_t count, size_t grain_size, const std::function<void(size_t, size_t)>& function)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	grain_size			= std::max<size_t>(grain_size, 1);
+	size_t chunk_count	= (count + grain_size - 1) / grain_size;
+	size_t helper_count = std::min<size_t>(mWorkers.size(), chunk_count - 1);
+
+	// not worth waking anyone up
+	if (helper_count == 0)
+	{
+		function(0, count);
+		return;
+	}
+
+	std::shared_ptr<ParallelForBatch> batch = std::make_shared<ParallelForBatch>();
+	batch->function							= &function;
+	batch->count							= count;
+	batch->grain_size						= grain_size;
+	batch->chunk_count						= chunk_count;
+
+	for (size_t i = 0; i < helper_count; i++)
+	{
+		Push([batch]() { batch->RunChunks(); });
+	}
+
+	batch->RunChunks();
+
+	// every chunk is taken, the last ones may still be running on the workers
+	// other jobs are left alone, a long Submit()-ed one would hold the caller up well past this batch
+	while (batch->finished_chunks.load() < chunk_count)
+	{
+		std::this_thread::yield();
+	}
+}
+
+unsigned JobSystem::GetWorkerCount() const
+{
+	return static_cast<unsigned>(mWorkers.size());
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef JOBSYSTEM_HPP
+#define JOBSYSTEM_HPP
+
+#include "Singleton.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// work stealing pool: every worker owns a queue, takes its newest job first and,
+// when it runs out, steals the oldest job of another worker
+// without workers (not initialized, or a single core) everything runs on the caller
+class JobSystem : public Singleton<JobSystem>
+{
+		struct WorkerQueue
+		{
+				std::mutex						  mutex;
+				std::deque<std::function<void()>> jobs;
+		};
+
+		std::vector<std::thread>				  mWorkers;
+		std::vector<std::unique_ptr<WorkerQueue>> mQueues;
+
+		// jobs pushed but not taken yet, workers sleep while it is zero
+		std::atomic<size_t>		mQueuedJobs { 0 };
+		std::atomic<size_t>		mNextQueue { 0 };
+		std::mutex				mSleepMutex;
+		std::condition_variable mJobAvailable;
+		bool					mStopping = false;
+
+		void WorkerLoop(size_t worker_index);
+		void Push(std::function<void()> job);
+		bool TryTakeJob(std::function<void()>& job);
+
+	public:
+		~JobSystem();
+
+		// worker_count == 0 uses one worker per hardware thread, minus the caller
+		void Initialize(unsigned worker_count = 0);
+		void Shutdown();
+
+		// runs the job on some worker (or right away when there are none)
+		void Submit(std::function<void()> job);
+
+		// calls function(begin, end) on chunks of at most grain_size elements covering [0, count)
+		// the caller takes chunks as well (never other jobs), and it returns once every chunk is done
+		void ParallelFor(size_t count, size_t grain_size, const std::function<void(size_t, size_t)>& function);
+
+		unsigned GetWorkerCount() const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include "MappedFile.hpp"
+
+#ifdef _WIN32
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& filepath)
+{
+	Close();
+
+	HANDLE file = CreateFileA(
+		filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(file, &size) == FALSE || size.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (data == nullptr)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	mFile	 = file;
+	mMapping = mapping;
+	mData	 = static_cast<const uint8_t*>(data);
+	mSize	 = static_cast<size_t>(size.QuadPart);
+
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (mData != nullptr)
+	{
+		UnmapViewOfFile(mData);
+		CloseHandle(mMapping);
+		CloseHandle(mFile);
+	}
+
+	mData	 = nullptr;
+	mSize	 = 0;
+	mFile	 = nullptr;
+	mMapping = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& filepath)
+{
+	Close();
+
+	int file = open(filepath.c_str(), O_RDONLY);
+	if (file == -1)
+	{
+		return false;
+	}
+
+	struct stat status;
+	if (fstat(file, &status) == -1 || status.st_size == 0)
+	{
+		close(file);
+		return false;
+	}
+
+	void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	if (data == MAP_FAILED)
+	{
+		close(file);
+		return false;
+	}
+
+	mFile = file;
+	mData = static_cast<const uint8_t*>(data);
+	mSize = static_cast<size_t>(status.st_size);
+
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (mData != nullptr)
+	{
+		munmap(const_cast<uint8_t*>(mData), mSize);
+		close(mFile);
+	}
+
+	mData = nullptr;
+	mSize = 0;
+	mFile = -1;
+}
+
+#endif
+
+bool MappedFile::IsOpen() const
+{
+	return mData != nullptr;
+}
+
+const uint8_t* MappedFile::GetData() const
+{
+	return mData;
+}
+
+size_t MappedFile::GetSize() const
+{
+	return mSize;
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// read-only view of a whole file, the pages are loaded by the OS as they are touched
+class MappedFile
+{
+		const uint8_t* mData = nullptr;
+		size_t		   mSize = 0;
+
+#ifdef _WIN32
+		void* mFile	   = nullptr;
+		void* mMapping = nullptr;
+#else
+		int mFile = -1;
+#endif
+
+	public:
+		MappedFile() = default;
+		~MappedFile();
+
+		// false if the file cannot be opened, or is empty
+		bool Open(const std::string& filepath);
+		void Close();
+
+		bool		   IsOpen() const;
+		const uint8_t* GetData() const;
+		size_t		   GetSize() const;
+
+		MappedFile(const MappedFile&)			 = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,27 @@
+#ifndef TYPEID_HPP
+#define TYPEID_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+// sequential identifiers handed out per family (e.g. TypeID<Component>)
+// the first time a type is queried, so they can be used to index flat arrays
+template <typename Family>
+class TypeID
+{
+		static inline std::atomic<uint32_t> id_generator = 0;
+
+	public:
+		static constexpr uint32_t INVALID = std::numeric_limits<uint32_t>::max();
+
+		template <typename T>
+		static uint32_t Get();
+
+		// amount of types that have been given an id so far
+		static uint32_t Count();
+};
+
+#include "TypeID.inl"
+
+#endif
\ No newline at end of file
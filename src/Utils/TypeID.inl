@@ -0,0 +1,15 @@
+#include "TypeID.hpp"
+
+template <typename Family>
+template <typename T>
+uint32_t TypeID<Family>::Get()
+{
+	static const uint32_t id = id_generator++;
+	return id;
+}
+
+template <typename Family>
+uint32_t TypeID<Family>::Count()
+{
+	return id_generator.load();
+}
\ No newline at end of file
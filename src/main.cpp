@@ -22,6 +22,12 @@
 #include "Transformation/HierarchyManager.hpp"
 #include "Input/InputManager.hpp"
 #include "Resources/ResourceManager.hpp"
+#include "Utils/JobSystem.hpp"
+#include "ECS/World.hpp"
+#include "Time/TimeManager.hpp"
+#include "Profiling/Profiler.hpp"
+#include "Profiling/GPUProfiler.hpp"
+#include "Memory/MemoryTracker.hpp"
 
 #include <stb_image.h>
 #include <glm/glm.hpp>
@@ -181,6 +187,8 @@ int main(int, char**)
 	stbi_set_flip_vertically_on_load(static_cast<bool>(true));
 
 	InputManager::GetInstance().Initialize();
+	JobSystem::GetInstance().Initialize();
+	Profiler::GetInstance().SetThreadName("Main");
 	Initialize();
 
 	// initialize delta time
@@ -207,18 +215,37 @@ int main(int, char**)
 			continue;
 		}
 
-		InputManager::GetInstance().Update();
-		LogicSystem::GetInstance().Update();
-		HierarchyManager::GetInstance().Update();
-		GameObjectManager::GetInstance().Update();
+		Profiler::GetInstance().BeginFrame();
+		GPUProfiler::GetInstance().BeginFrame();
 
 		// compute delta time
 		std::chrono::high_resolution_clock::time_point current_time = std::chrono::high_resolution_clock::now();
 		float delta = std::chrono::duration<float>(current_time - last_time).count();
 		last_time	= current_time;
 
+		InputManager::GetInstance().Update();
+
+		// the simulation advances in fixed steps, as many as fit in the elapsed time
+		const int steps = TimeManager::GetInstance().Advance(delta);
+		for (int step = 0; step < steps; step++)
+		{
+			PROFILE_ZONE("Simulation step");
+
+			HierarchyManager::GetInstance().BeginStep();
+			LogicSystem::GetInstance().Update(TimeManager::GetInstance().GetFixedDeltaTime());
+			World::GetInstance().Update(TimeManager::GetInstance().GetFixedDeltaTime());
+			HierarchyManager::GetInstance().Update();
+			GameObjectManager::GetInstance().Update();
+		}
+
+		// rendering happens somewhere between the last two steps
+		HierarchyManager::GetInstance().Interpolate(TimeManager::GetInstance().GetInterpolationAlpha());
+
 		Update(delta);
 
+		// GPU objects of the resources decoded by the workers
+		ResourceManager::GetInstance().Update();
+
 		// start the Dear ImGui frame
 		ImGui_ImplOpenGL3_NewFrame();
 		ImGui_ImplSDL3_NewFrame();
@@ -226,21 +253,28 @@ int main(int, char**)
 
 		Render();
 
-		gl::glPushDebugGroup(gl::GL_DEBUG_SOURCE_APPLICATION, 0, -1, "ImGui");
+		GPUProfiler::GetInstance().PushDebugGroup("ImGui");
 		// rendering
 		ImGui::Render();
 		gl::glViewport(0, 0, (int)io.DisplaySize.x, (int)io.DisplaySize.y);
 		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-		gl::glPopDebugGroup();
+		GPUProfiler::GetInstance().PopDebugGroup();
 
-		SDL_GL_SwapWindow(window);
+		{
+			// includes the wait for vsync
+			PROFILE_ZONE("Swap buffers");
+			SDL_GL_SwapWindow(window);
+		}
 	}
 
 	Shutdown();
 
 	InputManager::GetInstance().Shutdown();
 	GameObjectManager::GetInstance().Shutdown();
-	ResourceManager::GetInstance().DeleteResources();
+	World::GetInstance().Shutdown();
+	ResourceManager::GetInstance().Shutdown();
+	JobSystem::GetInstance().Shutdown();
+	GPUProfiler::GetInstance().Shutdown();
 
 	// cleanup
 	ImGui_ImplOpenGL3_Shutdown();
@@ -315,7 +349,7 @@ class DummyCamera : public LogicComponent
 			: transform { nullptr }
 			, m_projectionMatrix { glm::identity<glm::mat4>() }
 			, m_viewMatrix { glm::identity<glm::mat4>() }
-			, speed { 1.0f }
+			, speed { 60.0f }
 			, fovy { 45.0f }
 			, aspect_ratio { static_cast<float>(WINDOW_WIDTH) / WINDOW_HEIGHT }
 			, near { 0.1f }
@@ -346,14 +380,20 @@ class DummyCamera : public LogicComponent
 			}
 		}
 
-		virtual void Update() override
+		virtual void Update(float dt) override
+		{
+			Movement(dt);
+		}
+
+		// follows the interpolated transformation, so the view stays smooth between simulation steps
+		void ComputeViewMatrix()
 		{
-			Movement();
+			const glm::mat4& world_matrix = transform->GetInterpolatedWorldMatrix();
 
-			m_viewMatrix = glm::lookAt(
-				transform->GetWorldPosition(),
-				transform->GetWorldPosition() + transform->GetWorldRotation().forward,
-				Rotation::VECTOR_UP);
+			glm::vec3 position = glm::vec3 { world_matrix[3] };
+			glm::vec3 forward  = -glm::normalize(glm::vec3 { world_matrix[2] });
+
+			m_viewMatrix = glm::lookAt(position, position + forward, Rotation::VECTOR_UP);
 		}
 
 		const glm::mat4& GetProjectionMatrix() const
@@ -366,7 +406,7 @@ class DummyCamera : public LogicComponent
 			return m_viewMatrix;
 		}
 
-		void Movement()
+		void Movement(float dt)
 		{
 			InputManager& input = InputManager::GetInstance();
 
@@ -390,10 +430,10 @@ class DummyCamera : public LogicComponent
 				input_movement.x = 1.0f;
 			}
 
-			input_movement *= speed;
+			input_movement *= speed * dt;
 
-			glm::vec3 position = transform->GetWorldPosition() + input_movement.x * transform->GetWorldRotation().right
-							   + input_movement.y * transform->GetWorldRotation().forward;
+			glm::vec3 position = transform->GetWorldPosition() + input_movement.x * transform->GetWorldRotation().GetRight()
+							   + input_movement.y * transform->GetWorldRotation().GetForward();
 
 			transform->SetWorldPosition(position);
 		}
@@ -417,9 +457,9 @@ class MagicComponent : public LogicComponent
 			transform = GetComponent<TransformationComponent>();
 		}
 
-		virtual void Update() override
+		virtual void Update(float dt) override
 		{
-			transform->RotateAxis(-glm::radians(360.0f / rotation_duration) * (1.0f / 60.0f), Rotation::VECTOR_UP);
+			transform->RotateAxis(-glm::radians(360.0f / rotation_duration) * dt, Rotation::VECTOR_UP);
 		}
 
 		void Render()
@@ -427,7 +467,7 @@ class MagicComponent : public LogicComponent
 			if (model.IsValid() == false)
 				return;
 
-			const glm::mat4& model_mtx = transform->GetWorldMatrix();
+			const glm::mat4& model_mtx = transform->GetInterpolatedWorldMatrix();
 
 			// send uniforms to shader
 			glUniformMatrix4fv(2, 1, GL_FALSE, &model_mtx[0][0]);
@@ -565,8 +605,9 @@ void Initialize()
 
 	objects.push_back(GameObjectManager::GetInstance().NewGameObject("bichisua"));
 
-	Resource<Model>	  model { "data/meshes/pish.obj" };
-	Resource<Texture> texture { "data/images/pish.png" };
+	// decoded on the workers, the cube and the checkerboard are shown meanwhile
+	Resource<Model>	  model	  = ResourceManager::GetInstance().GetResourceAsync<Model>("data/meshes/pish.obj");
+	Resource<Texture> texture = ResourceManager::GetInstance().GetResourceAsync<Texture>("data/images/pish.png");
 	//Resource<Model>	  model { Model::CUBE_PRIMITIVE };
 	//Resource<Texture> texture { "data/colortest.png" };
 
@@ -626,10 +667,13 @@ void Initialize()
 
 void Update(float delta)
 {
+	camera->GetComponent<DummyCamera>()->ComputeViewMatrix();
 }
 
 void RenderScene()
 {
+	PROFILE_ZONE("Render scene");
+
 	static int current_field = 0;
 
 	if (interlaced == false)
@@ -641,7 +685,7 @@ void RenderScene()
 		current_field ^= 1;
 	}
 
-	glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, "Geometry pass");
+	GPUProfiler::GetInstance().PushDebugGroup("Geometry pass");
 
 	geometry_shader->Bind();
 
@@ -680,9 +724,9 @@ void RenderScene()
 		object->GetComponent<MagicComponent>()->Render();
 	}
 
-	glPopDebugGroup();
+	GPUProfiler::GetInstance().PopDebugGroup();
 
-	glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, "Render to screen");
+	GPUProfiler::GetInstance().PushDebugGroup("Render to screen");
 
 	screen_shader->Bind();
 
@@ -771,7 +815,7 @@ void RenderScene()
 
 	glUseProgram(0);
 
-	glPopDebugGroup();
+	GPUProfiler::GetInstance().PopDebugGroup();
 
 	glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
@@ -834,6 +878,33 @@ void Render()
 		GameObjectManager::GetInstance().Display();
 	}
 	ImGui::End();
+
+	if (ImGui::Begin("Time"))
+	{
+		TimeManager::GetInstance().Edit();
+	}
+	ImGui::End();
+
+	if (ImGui::Begin("Profiler"))
+	{
+		Profiler::GetInstance().Display();
+	}
+	ImGui::End();
+
+	if (ImGui::Begin("Memory"))
+	{
+		MemoryTracker::GetInstance().Display();
+
+		ImGui::Separator();
+		ImGui::Text("Resources loading: %zu", ResourceManager::GetInstance().GetLoadingCount());
+
+		float finalize_budget = ResourceManager::GetInstance().GetFinalizeBudget();
+		if (ImGui::DragFloat("Finalize budget (ms)", &finalize_budget, 0.1f, 0.0f, 100.0f))
+		{
+			ResourceManager::GetInstance().SetFinalizeBudget(finalize_budget);
+		}
+	}
+	ImGui::End();
 }
 
 void Shutdown()